@@ -0,0 +1,903 @@
+// Copyright 2016 Jonathan D. Lettvin All Rights Reserved
+/// atoull.bench.cpp
+/// Timing of the lexers in atoull.h.cpp against the C and C++ libraries.
+/// Built and run by "make bench" (C++17 for std::from_chars).
+///
+/// ./atoull.bench [suite] runs every suite, or only the one named:
+///   digits   lexDecU64t and lexDecU64<W> at each digit count 1..20
+///   mixes    uniform, log-uniform, feed-like and error-heavy lengths
+///   float fixed hex pressure threads lines stream records: the others
+///   wide     lexDecU128t on 21 to 39 digit keys against a checked loop
+///   time     lexTimeU64t against strptime, sscanf and timegm
+///   format   fmtDecU64t against snprintf, std::to_chars and ostream
+///   range    lexRangeU64t against lexing into a vector first
+///   filter   lexFilterU64t keeping [lo, hi] against lexing and testing
+///   reduce   lexAggregateU64t against lexing a column and reducing it
+///   fix      lexTagValue on FIX messages against strchr and strtoull
+/// Each result is printed and written as a row of atoull.bench.csv
+/// (atoull.bench.compact.csv from a -DLETTVIN_LEXDEC_COMPACT=1 build):
+///   suite,case,method,numbers,bytes,ns_per_number,bytes_per_cycle
+/// ns_per_number is the best of 7 passes.  bytes_per_cycle divides the
+/// field bytes by time stamp counter ticks, which run at the nominal
+/// clock rather than the core clock; it is 0 where there is no counter.
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "atoull.h.cpp"
+
+namespace {
+
+typedef Lettvin::u64t u64t;
+
+volatile u64t sink;  ///< keeps every checksum live
+
+u64t ticks() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+u64t lcg(u64t &x) {  // NOLINT
+    return x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+}
+
+/// A d digit decimal, leading digit non-zero, never above 2^64 - 1.
+std::string digits(size_t d, u64t &x) {  // NOLINT
+    const u64t low = Lettvin::decPower(d - 1);
+    if (d == 20) return std::to_string(low + lcg(x) % (~0ULL - low + 1));
+    return std::to_string(low + lcg(x) % (9 * low));
+}
+
+/// Prints each result and keeps it as a CSV row.
+class Report {
+ public:
+    explicit Report(const char *path) : csv_(path) {
+        csv_ << "suite,case,method,numbers,bytes,ns_per_number,"
+            "bytes_per_cycle" << std::endl;
+    }
+
+    /// Time pass(), one sweep over numbers values held in bytes bytes.
+    template <typename P>
+    void operator()(const std::string &suite, const std::string &name,
+            const std::string &method, size_t numbers, size_t bytes,
+            P pass) {
+        double ns = 1e300, tsc = 1e300;
+        for (int k = 0; k < 7; ++k) {
+            const auto t0 = std::chrono::steady_clock::now();
+            const u64t c0 = ticks();
+            pass();
+            const u64t c1 = ticks();
+            const auto t1 = std::chrono::steady_clock::now();
+            ns = std::min(ns, std::chrono::duration<double, std::nano>(
+                        t1 - t0).count());
+            tsc = std::min(tsc, static_cast<double>(c1 - c0));
+        }
+        const double bpc = tsc > 0 ? bytes / tsc : 0;
+        std::cout << std::left << std::setw(9) << suite <<
+            std::setw(12) << name << std::setw(21) << method <<
+            std::right << std::fixed << std::setprecision(2) <<
+            std::setw(9) << ns / numbers << " ns/number" <<
+            std::setw(6) << bpc << " bytes/cycle" << std::endl;
+        csv_ << suite << ',' << name << ',' << method << ',' << numbers <<
+            ',' << bytes << ',' << ns / numbers << ',' << bpc << std::endl;
+    }
+
+ private:
+    std::ofstream csv_;
+};
+
+/// Fields each followed by ',', with offsets and widths so that every
+/// method starts from the same bytes without chasing end pointers.
+struct Fields {
+    std::string text;
+    std::vector<size_t> at, width;
+    size_t bytes = 0;
+
+    void add(const std::string &field) {
+        at.push_back(text.size());
+        width.push_back(field.size());
+        bytes += field.size();
+        text += field + ',';
+    }
+    /// Pad so that 64 byte loads from the last field stay in the string.
+    char *close() {
+        text += std::string(64, ',');
+        return &text[0];
+    }
+    size_t size() const { return at.size(); }
+};
+
+/// lexDecU64t, counted and delimited, against strtoull, from_chars and
+/// the textbook loop.
+void methods(Report &report, const std::string &suite,  // NOLINT
+        const std::string &name, Fields &f) {  // NOLINT
+    char *text = f.close();
+    const size_t n = f.size();
+    report(suite, name, "lexDecU64t", n, f.bytes, [&]() {
+        u64t sum = 0;
+        for (size_t i = 0; i < n; ++i) {
+            char *s = text + f.at[i];
+            u64t v = 0, e = 0;
+            Lettvin::lexDecU64_Instance(v, s, e, f.width[i]);
+            sum += v;
+        }
+        sink = sum;
+    });
+    report(suite, name, "lexDecU64t.delimited", n, f.bytes, [&]() {
+        u64t sum = 0;
+        for (size_t i = 0; i < n; ++i) {
+            char *s = text + f.at[i];
+            u64t v = 0, e = 0;
+            Lettvin::lexDecU64_Instance.delimited(v, s, e);
+            sum += v;
+        }
+        sink = sum;
+    });
+    report(suite, name, "strtoull", n, f.bytes, [&]() {
+        u64t sum = 0;
+        for (size_t i = 0; i < n; ++i) {
+            char *end;
+            sum += strtoull(text + f.at[i], &end, 10);
+        }
+        sink = sum;
+    });
+    report(suite, name, "from_chars", n, f.bytes, [&]() {
+        u64t sum = 0;
+        for (size_t i = 0; i < n; ++i) {
+            const char *s = text + f.at[i];
+            u64t v = 0;
+            std::from_chars(s, s + f.width[i], v);
+            sum += v;
+        }
+        sink = sum;
+    });
+    report(suite, name, "naive", n, f.bytes, [&]() {
+        u64t sum = 0;
+        for (size_t i = 0; i < n; ++i) {
+            u64t v = 0;
+            for (const char *s = text + f.at[i];
+                    static_cast<unsigned>(*s - '0') < 10; ++s) {
+                v = v * 10 + (*s - '0');
+            }
+            sum += v;
+        }
+        sink = sum;
+    });
+}
+
+/// lexDecU64<W> over fields all W digits wide, after methods().
+template <size_t W>
+void fixedWidth(Report &report, Fields &f) {  // NOLINT
+    char *text = &f.text[0];
+    const size_t n = f.size();
+    report("digits", std::to_string(W), "lexDecU64<W>", n, f.bytes, [&]() {
+        u64t sum = 0;
+        for (size_t i = 0; i < n; ++i) {
+            char *s = text + f.at[i];
+            u64t v = 0, e = 0;
+            Lettvin::lexDecU64<W>::lex(v, s, e, ~0ULL, 0);
+            sum += v;
+        }
+        sink = sum;
+    });
+}
+template <size_t... W>
+void fixedWidth(Report &report, Fields &f, size_t d,  // NOLINT
+        std::index_sequence<W...>) {
+    static void (*const width[])(Report &, Fields &) = {
+        &fixedWidth<W + 1>... };
+    width[d - 1](report, f);
+}
+
+/// Every method at each digit count from 1 to 20.
+void digitCounts(Report &report, size_t count) {  // NOLINT
+    u64t x = 20160526ULL;
+    for (size_t d = 1; d <= 20; ++d) {
+        Fields f;
+        for (size_t i = 0; i < count; ++i) f.add(digits(d, x));
+        methods(report, "digits", std::to_string(d), f);
+        fixedWidth(report, f, d, std::make_index_sequence<20>());
+    }
+}
+
+/// Every method over mixed lengths: uniform u64t values (nearly all 19
+/// or 20 digits), log-uniform (each digit count equally often), a feed
+/// (mostly short sizes and prices, some long IDs) and errors (3 in 10
+/// fields overflow or hold a non-digit).
+void mixes(Report &report, size_t count) {  // NOLINT
+    u64t x = 20160527ULL;
+    Fields uniform, logUniform, feed, errors;
+    for (size_t i = 0; i < count; ++i) {
+        uniform.add(std::to_string(lcg(x)));
+        logUniform.add(digits(1 + lcg(x) % 20, x));
+        const size_t r = lcg(x) % 100;
+        feed.add(digits(r < 45 ? 1 + r % 4 : r < 80 ? 5 + r % 5 :
+                    10 + r % 10, x));
+        std::string field = digits(1 + lcg(x) % 20, x);
+        const size_t bad = lcg(x) % 20;
+        if (bad < 3) {
+            field = "99999999999999999999";
+        } else if (bad < 6) {
+            field[lcg(x) % field.size()] = 'x';
+        }
+        errors.add(field);
+    }
+    methods(report, "mixes", "uniform", uniform);
+    methods(report, "mixes", "log-uniform", logUniform);
+    methods(report, "mixes", "feed", feed);
+    methods(report, "mixes", "errors", errors);
+}
+
+/// Decimal fields shaped like prices and rates.
+Fields prices(size_t count) {
+    Fields f;
+    u64t x = 20160518ULL;
+    char buffer[64];
+    for (size_t i = 0; i < count; ++i) {
+        lcg(x);
+        const int whole = static_cast<int>((x >> 33) % 100000);
+        const int places = 2 + static_cast<int>((x >> 50) % 7);
+        const int fraction = static_cast<int>(
+                (x >> 13) % Lettvin::decPower(places));
+        snprintf(buffer, sizeof(buffer), "%d.%0*d", whole, places,
+                fraction);
+        f.add(buffer);
+    }
+    f.close();
+    return f;
+}
+
+/// lexDec<F> against strtod/strtof and from_chars.
+template <typename F>
+void floats(Report &report, const char *type, Fields &f) {  // NOLINT
+    char *text = &f.text[0];
+    const size_t n = f.size();
+    report("float", type, "lexDec", n, f.bytes, [&]() {
+        F sum = 0;
+        for (size_t i = 0; i < n; ++i) {
+            char *s = text + f.at[i];
+            u64t e = 0;
+            F v = 0;
+            Lettvin::lexDec<F>()(v, s, e);
+            sum += v;
+        }
+        sink = static_cast<u64t>(sum);
+    });
+    report("float", type, sizeof(F) == 8 ? "strtod" : "strtof", n,
+            f.bytes, [&]() {
+        F sum = 0;
+        for (size_t i = 0; i < n; ++i) {
+            char *end;
+            sum += sizeof(F) == 8 ? strtod(text + f.at[i], &end) :
+                strtof(text + f.at[i], &end);
+        }
+        sink = static_cast<u64t>(sum);
+    });
+    report("float", type, "from_chars", n, f.bytes, [&]() {
+        F sum = 0;
+        for (size_t i = 0; i < n; ++i) {
+            const char *s = text + f.at[i];
+            F v = 0;
+            std::from_chars(s, s + f.width[i], v);
+            sum += v;
+        }
+        sink = static_cast<u64t>(sum);
+    });
+}
+
+/// Prices at scale 8: lexFixS64t against strtod and a multiply.
+void fixed(Report &report, Fields &f) {  // NOLINT
+    char *text = &f.text[0];
+    const size_t n = f.size();
+    report("fixed", "scale 8", "lexFixS64t", n, f.bytes, [&]() {
+        u64t sum = 0;
+        for (size_t i = 0; i < n; ++i) {
+            char *s = text + f.at[i];
+            u64t e = 0;
+            Lettvin::s64t v = 0;
+            Lettvin::lexFixS64_Instance.delimited(v, s, e, 8);
+            sum += v;
+        }
+        sink = sum;
+    });
+    report("fixed", "scale 8", "strtod*1e8", n, f.bytes, [&]() {
+        u64t sum = 0;
+        for (size_t i = 0; i < n; ++i) {
+            char *end;
+            sum += llround(strtod(text + f.at[i], &end) * 1e8);
+        }
+        sink = sum;
+    });
+}
+
+/// FIX-style UTC stamps of 17 to 27 bytes: lexTimeU64t, its table
+/// engine alone, and strptime or sscanf with timegm.
+void stamps(Report &report, size_t count) {  // NOLINT
+    Fields f;
+    u64t x = 20180712ULL;
+    char buffer[48];
+    const size_t lengths[] = { 17, 21, 24, 27 };
+    for (size_t i = 0; i < count; ++i) {
+        lcg(x);
+        const time_t t = static_cast<time_t>(1500000000 + (x >> 36));
+        struct tm when;
+        gmtime_r(&t, &when);
+        strftime(buffer, sizeof(buffer), "%Y%m%d-%H:%M:%S", &when);
+        snprintf(buffer + 17, sizeof(buffer) - 17, ".%09llu",
+                static_cast<unsigned long long>(x % 1000000000));
+        f.add(std::string(buffer, lengths[(x >> 20) % 4]));
+    }
+    char *text = f.close();
+    report("time", "17-27", "lexTimeU64t", count, f.bytes, [&]() {
+        u64t sum = 0;
+        for (size_t i = 0; i < count; ++i) {
+            char *s = text + f.at[i];
+            u64t v = 0, e = 0;
+            Lettvin::lexTimeU64_Instance(v, s, e, f.width[i]);
+            sum += v;
+        }
+        sink = sum;
+    });
+    report("time", "17-27", "lexTimeU64t.scalar", count, f.bytes, [&]() {
+        u64t sum = 0;
+        for (size_t i = 0; i < count; ++i) {
+            char *s = text + f.at[i];
+            u64t v = 0, e = 0;
+            Lettvin::lexTimeU64t::scalar(v, s, e, f.width[i], ~0ULL, 0);
+            sum += v;
+        }
+        sink = sum;
+    });
+    report("time", "17-27", "strptime+timegm", count, f.bytes, [&]() {
+        u64t sum = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const char *s = text + f.at[i];
+            struct tm when = {};
+            const char *rest = strptime(s, "%Y%m%d-%H:%M:%S", &when);
+            u64t nanos = 0;
+            if (rest && f.width[i] > 18) {
+                nanos = strtoull(rest + 1, nullptr, 10);
+                for (size_t n = f.width[i]; n < 27; ++n) nanos *= 10;
+            }
+            sum += u64t(timegm(&when)) * 1000000000 + nanos;
+        }
+        sink = sum;
+    });
+    report("time", "17-27", "sscanf+timegm", count, f.bytes, [&]() {
+        u64t sum = 0;
+        for (size_t i = 0; i < count; ++i) {
+            char field[32];   ///< sscanf measures its input first
+            memcpy(field, text + f.at[i], f.width[i]);
+            field[f.width[i]] = 0;
+            struct tm when = {};
+            unsigned nanos = 0;
+            sscanf(field, "%4d%2d%2d-%2d:%2d:%2d.%9u",
+                    &when.tm_year, &when.tm_mon, &when.tm_mday,
+                    &when.tm_hour, &when.tm_min, &when.tm_sec, &nanos);
+            when.tm_year -= 1900;
+            when.tm_mon -= 1;
+            for (size_t n = f.width[i]; n < 27 && n > 18; ++n) nanos *= 10;
+            sum += u64t(timegm(&when)) * 1000000000 + nanos;
+        }
+        sink = sum;
+    });
+}
+
+/// Order IDs of 8 to 16 hex digits: lexHexU64t against strtoull.
+void hex(Report &report, size_t count) {  // NOLINT
+    Fields f;
+    u64t x = 20160521ULL;
+    char buffer[32];
+    for (size_t i = 0; i < count; ++i) {
+        lcg(x);
+        const int width = 8 + static_cast<int>((x >> 60) % 9);
+        snprintf(buffer, sizeof(buffer), "%0*llx", width,
+                static_cast<unsigned long long>(x >> (64 - 4 * width)));
+        f.add(buffer);
+    }
+    char *text = f.close();
+    report("hex", "8-16", "lexHexU64t", count, f.bytes, [&]() {
+        u64t sum = 0;
+        for (size_t i = 0; i < count; ++i) {
+            char *s = text + f.at[i];
+            u64t v = 0, e = 0;
+            Lettvin::lexHexU64_Instance(v, s, e, f.width[i]);
+            sum += v;
+        }
+        sink = sum;
+    });
+    report("hex", "8-16", "strtoull", count, f.bytes, [&]() {
+        u64t sum = 0;
+        for (size_t i = 0; i < count; ++i) {
+            char *end;
+            sum += strtoull(text + f.at[i], &end, 16);
+        }
+        sink = sum;
+    });
+}
+
+/// Keys of 21 to 39 digits: lexDecU128t against a checked digit loop.
+void wide(Report &report, size_t count) {  // NOLINT
+    Fields f;
+    u64t x = 20180711ULL;
+    for (size_t i = 0; i < count; ++i) {
+        const size_t d = 21 + lcg(x) % 19;
+        const u64t lead = 1 + lcg(x) % (d < 39 ? 9 : 3);
+        std::string field(1, static_cast<char>('0' + lead));
+        while (field.size() < d) field += static_cast<char>('0' + lcg(x) % 10);
+        f.add(field);
+    }
+    char *text = f.close();
+    report("wide", "21-39", "lexDecU128t", count, f.bytes, [&]() {
+        Lettvin::u128t sum = 0;
+        for (size_t i = 0; i < count; ++i) {
+            char *s = text + f.at[i];
+            Lettvin::u128t v = 0;
+            u64t e = 0;
+            Lettvin::lexDecU128_Instance(v, s, e, f.width[i]);
+            sum += v;
+        }
+        sink = static_cast<u64t>(sum ^ (sum >> 64));
+    });
+    report("wide", "21-39", "loop", count, f.bytes, [&]() {
+        Lettvin::u128t sum = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const char *s = text + f.at[i];
+            Lettvin::u128t v = 0;
+            bool e = false;
+            for (size_t k = 0; k < f.width[i]; ++k) {
+                e |= __builtin_mul_overflow(v, 10, &v) ||
+                    __builtin_add_overflow(v, s[k] - '0', &v);
+            }
+            sum += e ? 0 : v;
+        }
+        sink = static_cast<u64t>(sum ^ (sum >> 64));
+    });
+}
+
+/// lexDecU64t fields of 1 to 7 digits (below the vector kernel, so the
+/// tables do the work) interleaved with reads of a 32 KB working set, as
+/// when the lexer shares the L1 with the rest of a parser.
+void pressure(Report &report, size_t count) {  // NOLINT
+    Fields f;
+    u64t x = 20160522ULL;
+    for (size_t i = 0; i < count; ++i) f.add(digits(1 + lcg(x) % 7, x));
+    char *text = f.close();
+    static u64t hot[4096];
+    report("pressure", "1-7", LETTVIN_LEXDEC_COMPACT ?
+            "lexDecU64t(compact)" : "lexDecU64t(full)", count, f.bytes,
+            [&]() {
+        u64t sum = 0;
+        size_t h = 0;
+        for (size_t i = 0; i < count; ++i) {
+            char *s = text + f.at[i];
+            u64t v = 0, e = 0;
+            Lettvin::lexDecU64_Instance(v, s, e, f.width[i]);
+            for (int j = 0; j < 8; ++j, h = (h + 67) & 4095) v += hot[h]++;
+            sum += v;
+        }
+        sink = sum;
+    });
+}
+
+/// Aggregate lexDecU64t throughput from 1 thread up to one per core,
+/// each thread lexing its own copy of 1 to 20 digit fields.
+void threads(Report &report, size_t count) {  // NOLINT
+    Fields f;
+    u64t x = 20160523ULL;
+    for (size_t i = 0; i < count; ++i) f.add(digits(1 + lcg(x) % 20, x));
+    f.close();
+    const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned n = 1; n <= cores; n = n < cores && 2 * n > cores ?
+            cores : 2 * n) {
+        std::vector<std::string> copies(n, f.text);
+        report("threads", std::to_string(n), "lexDecU64t.delimited",
+                n * count, n * f.bytes, [&]() {
+            std::vector<std::thread> pool;
+            for (unsigned t = 0; t < n; ++t) {
+                pool.emplace_back([&, t]() {
+                    char *text = &copies[t][0];
+                    u64t sum = 0;
+                    for (size_t i = 0; i < count; ++i) {
+                        char *s = text + f.at[i];
+                        u64t v = 0, e = 0;
+                        Lettvin::lexDecU64_Instance.delimited(v, s, e);
+                        sum += v;
+                    }
+                    sink = sum;
+                });
+            }
+            for (auto &thread : pool) thread.join();
+        });
+    }
+}
+
+/// One u64t per line from a file: lexLinesU64t::map() against the
+/// getline-and-lex loop it replaces (file in the page cache), and the
+/// same column read back from a current lexCacheU64t sidecar.
+void lines(Report &report, size_t count) {  // NOLINT
+    const char *path = "atoull.bench.lines.txt";
+    size_t bytes = 0;
+    {
+        std::ofstream out(path);
+        u64t x = 20160524ULL;
+        for (size_t i = 0; i < count; ++i) {
+            const std::string field = digits(1 + lcg(x) % 20, x);
+            bytes += field.size() + 1;
+            out << field << '\n';
+        }
+    }
+    std::vector<u64t> mapped, read;
+    report("lines", "1-20", "lexLinesU64t.map", count, bytes, [&]() {
+        std::vector<u64t> errors;
+        u64t e = 0;
+        Lettvin::lexLinesU64_Instance.map(path, mapped, errors, e);
+    });
+    report("lines", "1-20", "getline+lexDecU64t", count, bytes, [&]() {
+        std::ifstream in(path);
+        read.clear();
+        for (std::string line; std::getline(in, line); ) {
+            char *s = &line[0];
+            u64t v = 0, e = 0;
+            Lettvin::lexDecU64_Instance(v, s, e, line.size());
+            read.push_back(v);
+        }
+    });
+    const std::string side = std::string(path) + ".u64";
+    u64t cached = 0;
+    {
+        Lettvin::lexCacheU64t cache;   ///< build the sidecar, untimed
+        u64t e = 0;
+        cache.open(path, e, side.c_str());
+    }
+    report("lines", "1-20", "lexCacheU64t.mapped", count, bytes, [&]() {
+        Lettvin::lexCacheU64t cache;
+        u64t e = 0, sum = 0;
+        cache.open(path, e, side.c_str());
+        for (size_t i = 0; i < cache.size(); ++i) sum += cache.values()[i];
+        cached = cache.cached() ? sum : ~sum;
+    });
+    remove(path);
+    remove(side.c_str());
+    if (mapped != read) std::cout << "lines MISMATCH" << std::endl;
+    if (cached != std::accumulate(read.begin(), read.end(), u64t(0)))
+        std::cout << "lines cache MISMATCH" << std::endl;
+}
+
+/// Newline-separated values through lexStreamU64t against operator>>.
+void stream(Report &report, size_t count) {  // NOLINT
+    std::string text;
+    u64t x = 20160525ULL;
+    for (size_t i = 0; i < count; ++i) {
+        text += digits(1 + lcg(x) % 20, x) + '\n';
+    }
+    u64t a = 0, b = 0;
+    report("stream", "1-20", "lexStreamU64t", count, text.size(), [&]() {
+        std::istringstream in(text);
+        Lettvin::lexStreamU64t lexer(in);
+        a = 0;
+        for (u64t v, e = 0; lexer(v, e); e = 0) a += v;
+    });
+    report("stream", "1-20", "operator>>", count, text.size(), [&]() {
+        std::istringstream in(text);
+        b = 0;
+        for (unsigned long long v; in >> v; ) b += v;
+    });
+    if (a != b) std::cout << "stream MISMATCH" << std::endl;
+}
+
+/// Rows of three u64t columns: lexRecords against splitting each row
+/// with strchr and lexing each field with lexDecU64t.
+void records(Report &report, size_t count) {  // NOLINT
+    std::string text;
+    u64t x = 20160528ULL;
+    for (size_t i = 0; i < count; ++i) {
+        text += digits(1 + lcg(x) % 20, x) + ',' + digits(1 + lcg(x) % 9, x) +
+            ',' + digits(1 + lcg(x) % 6, x) + '\n';
+    }
+    typedef Lettvin::lexCsv<Lettvin::recColumn<u64t>,
+            Lettvin::recColumn<u64t>, Lettvin::recColumn<u64t> > csv;
+    csv::table columns;
+    std::vector<u64t> errors;
+    report("records", "3 x u64t", "lexRecords", 3 * count, text.size(),
+            [&]() {
+        sink = csv()(text.c_str(), text.size(), columns, errors);
+    });
+    std::vector<u64t> split[3];
+    report("records", "3 x u64t", "strchr+lexDecU64t", 3 * count,
+            text.size(), [&]() {
+        for (auto &column : split) column.clear();
+        char *s = &text[0], *end = s + text.size();
+        while (s < end) {
+            for (size_t k = 0; k < 3; ++k) {
+                char *stop = strchr(s, k < 2 ? ',' : '\n');
+                u64t v = 0, e = 0;
+                Lettvin::lexDecU64_Instance(v, s, e, stop - s);
+                split[k].push_back(v);
+                s = stop + 1;
+            }
+        }
+    });
+    if (std::get<0>(columns) != split[0] || std::get<2>(columns) != split[2])
+        std::cout << "records MISMATCH" << std::endl;
+}
+
+/// Writing 1 to 20 digit values: fmtDecU64t, minimal and in width 20,
+/// against snprintf, std::to_chars and std::ostream.
+void format(Report &report, size_t count) {  // NOLINT
+    std::vector<u64t> values;
+    u64t x = 20160529ULL;
+    for (size_t i = 0; i < count; ++i) {
+        values.push_back(std::stoull(digits(1 + lcg(x) % 20, x)));
+    }
+    size_t bytes = 0;
+    for (u64t v : values) bytes += Lettvin::fmtDecU64t::digits(v);
+    std::vector<char> out(21 * count + 64);
+    report("format", "1-20", "fmtDecU64t", count, bytes, [&]() {
+        char *s = out.data();
+        for (u64t v : values) {
+            Lettvin::fmtDecU64_Instance(s, v);
+            *s++ = '\n';
+        }
+        sink = s - out.data();
+    });
+    report("format", "1-20", "fmtDecU64t(20)", count, 20 * count, [&]() {
+        char *s = out.data();
+        for (u64t v : values) {
+            u64t e = 0;
+            Lettvin::fmtDecU64_Instance(s, v, e, 20);
+            *s++ = '\n';
+        }
+        sink = s - out.data();
+    });
+    report("format", "1-20", "snprintf", count, bytes, [&]() {
+        char *s = out.data();
+        for (u64t v : values) {
+            s += snprintf(s, 22, "%llu\n", static_cast<unsigned long long>(v));
+        }
+        sink = s - out.data();
+    });
+    report("format", "1-20", "to_chars", count, bytes, [&]() {
+        char *s = out.data();
+        for (u64t v : values) {
+            s = std::to_chars(s, s + 20, v).ptr;
+            *s++ = '\n';
+        }
+        sink = s - out.data();
+    });
+    report("format", "1-20", "ostream<<", count, bytes, [&]() {
+        std::ostringstream os;
+        for (u64t v : values) os << v << '\n';
+        sink = os.tellp();
+    });
+}
+
+/// Summing comma-separated values: lexRangeU64t straight from the text
+/// against lexing into a vector with lexDecU64t::delimited() first.
+void range(Report &report, size_t count) {  // NOLINT
+    std::string text;
+    u64t x = 20160530ULL;
+    for (size_t i = 0; i < count; ++i) {
+        text += digits(1 + lcg(x) % 20, x) + ',';
+    }
+    report("range", "1-20", "lexRangeU64t", count, text.size(), [&]() {
+        Lettvin::lexRangeU64t values(text.data(), text.size(), ',');
+        sink = std::accumulate(values.begin(), values.end(), u64t(0));
+    });
+    std::vector<u64t> column;
+    report("range", "1-20", "vector+accumulate", count, text.size(), [&]() {
+        column.clear();
+        char *s = &text[0];
+        for (size_t i = 0; i < count; ++i, ++s) {
+            u64t v = 0, e = 0;
+            Lettvin::lexDecU64_Instance.delimited(v, s, e);
+            column.push_back(v);
+        }
+        sink = std::accumulate(column.begin(), column.end(), u64t(0));
+    });
+}
+
+/// Keeping a narrow slice of IDs: lexFilterU64t, which decides most
+/// fields from their width and leading digit, against lexing every
+/// field (lexRangeU64t, or delimited()) and testing the value.  The
+/// slice is [1e11, 2e11): about 1 field in 180 of 1-20 digits, and
+/// 1 in 9 of 12 digits, where only the leading digit can reject early.
+void filter(Report &report, size_t count) {  // NOLINT
+    const u64t lo = 100000000000ULL, hi = 199999999999ULL;
+    for (size_t fixed = 0; fixed < 2; ++fixed) {
+        std::string text;
+        u64t x = 20160531ULL;
+        for (size_t i = 0; i < count; ++i) {
+            text += digits(fixed ? 12 : 1 + lcg(x) % 20, x) + '\n';
+        }
+        const std::string name = fixed ? "12" : "1-20";
+        std::vector<u64t> kept;
+        size_t want = 0;
+        report("filter", name, "lexFilterU64t", count, text.size(), [&]() {
+            kept.clear();
+            Lettvin::lexFilterU64t slice(lo, hi);
+            slice(text.data(), text.size(), &kept);
+            want = kept.size();
+        });
+        report("filter", name, "lexRangeU64t+test", count, text.size(),
+                [&]() {
+            kept.clear();
+            Lettvin::lexRangeU64t values(text.data(), text.size());
+            for (u64t v : values) if (v >= lo && v <= hi) kept.push_back(v);
+        });
+        if (kept.size() != want) std::cout << "filter MISMATCH" << std::endl;
+        report("filter", name, "delimited+test", count, text.size(), [&]() {
+            kept.clear();
+            char *s = &text[0];
+            for (size_t i = 0; i < count; ++i, ++s) {
+                u64t v = 0, e = 0;
+                Lettvin::lexDecU64_Instance.delimited(v, s, e);
+                if (!e && v >= lo && v <= hi) kept.push_back(v);
+            }
+        });
+        if (kept.size() != want) std::cout << "filter MISMATCH" << std::endl;
+    }
+}
+
+/// Count, sum, min, max and log2 histogram of a column of 1-20 digit
+/// values: lexAggregateU64t reducing as it lexes (one chunk, and a chunk
+/// per hardware thread) against lexing into a vector and reducing that.
+void reduce(Report &report, size_t count) {  // NOLINT
+    std::string text;
+    u64t x = 20160601ULL;
+    for (size_t i = 0; i < count; ++i) {
+        text += digits(1 + lcg(x) % 20, x) + '\n';
+    }
+    const Lettvin::lexAggregateU64t all;
+    u64t want = 0, got = 0;
+    report("reduce", "1-20", "lexAggregateU64t", count, text.size(),
+            [&]() {
+        want = all(text.data(), text.size()).sum[0];
+    });
+    report("reduce", "1-20", "lexAggregateU64t.mt", count,
+            text.size(), [&]() {
+        got = all(text.data(), text.size(), 0).sum[0];
+    });
+    if (got != want) std::cout << "reduce MISMATCH" << std::endl;
+    std::vector<u64t> column, errors;
+    report("reduce", "1-20", "lexLinesU64t+reduce", count, text.size(),
+            [&]() {
+        Lettvin::lexLinesU64_Instance(text.data(), text.size(), column,
+                errors, 1);
+        u64t low = 0, high = 0, min = ~0ULL, max = 0, log2[65] = {};
+        for (u64t v : column) {
+            low += v;
+            high += low < v;
+            min = std::min(min, v);
+            max = std::max(max, v);
+            ++log2[v ? 64 - Lettvin::bitClz(v) : 0];
+        }
+        got = low;
+        sink = high + min + max + log2[64];
+    });
+    if (got != want) std::cout << "reduce MISMATCH" << std::endl;
+}
+
+/// FIX NewOrderSingle-like messages of 12 fields with a checksum:
+/// lexTagValue decoding and looking up 3 numbers, against strchr
+/// splitting with strtoull and a byte loop for the checksum.
+void fix(Report &report, size_t count) {  // NOLINT
+    const char soh = '\001';
+    std::string text;
+    std::vector<size_t> at, size;
+    u64t x = 20180713ULL;
+    for (size_t i = 0; i < count; ++i) {
+        char m[512];
+        int n = snprintf(m, sizeof(m), "8=FIX.4.4%c9=178%c35=D%c49=GATEWAY%c"
+                "56=EXCHANGE%c34=%llu%c52=20180713-12:34:56.789%c11=%llu%c"
+                "55=XYZ%c54=%llu%c38=%llu%c44=%llu.%02llu%c", soh, soh, soh,
+                soh, soh, static_cast<unsigned long long>(i), soh, soh,
+                static_cast<unsigned long long>(lcg(x) >> 20), soh, soh,
+                static_cast<unsigned long long>(1 + (x >> 10) % 2), soh,
+                static_cast<unsigned long long>(lcg(x) % 100000), soh,
+                static_cast<unsigned long long>(x >> 50),
+                static_cast<unsigned long long>(x % 100), soh);
+        unsigned sum = 0;
+        for (int k = 0; k < n; ++k) sum += static_cast<unsigned char>(m[k]);
+        n += snprintf(m + n, sizeof(m) - n, "10=%03u%c", sum % 256, soh);
+        at.push_back(text.size());
+        size.push_back(n);
+        text.append(m, n);
+    }
+    report("fix", "12 fields", "lexTagValue", count, text.size(), [&]() {
+        static Lettvin::lexTagValue<> decode;
+        u64t total = 0;
+        for (size_t i = 0; i < count; ++i) {
+            u64t e = 0, seq = 0, side = 0, quantity = 0;
+            decode(text.data() + at[i], size[i], e);
+            decode.number(seq, 34, e);
+            decode.number(side, 54, e);
+            decode.number(quantity, 38, e);
+            total += e ? 0 : seq + side + quantity;
+        }
+        sink = total;
+    });
+    report("fix", "12 fields", "strchr+strtoull", count, text.size(), [&]() {
+        u64t total = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const char *p = text.data() + at[i], *end = p + size[i];
+            u64t value[64] = {}, sum = 0, check = 0;
+            bool ok = true;
+            for (const char *f = p; f < end; ) {
+                const char *eq = static_cast<const char *>(
+                        memchr(f, '=', end - f));
+                const char *stop = static_cast<const char *>(
+                        memchr(f, soh, end - f));
+                if (!eq || !stop || eq > stop) { ok = false; break; }
+                const u64t tag = strtoull(f, 0, 10);
+                if (tag == 10) {
+                    for (const char *b = p; b < f; ++b) {
+                        sum += static_cast<unsigned char>(*b);
+                    }
+                    check = strtoull(eq + 1, 0, 10);
+                } else if (tag < 64) {
+                    value[tag] = strtoull(eq + 1, 0, 10);
+                }
+                f = stop + 1;
+            }
+            ok &= sum % 256 == check;
+            total += ok ? value[34] + value[54] + value[38] : 0;
+        }
+        sink = total;
+    });
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const std::string suite = argc > 1 ? argv[1] : "all";
+    const bool all = suite == "all";
+    const size_t count = 1 << 16;
+    Report report(LETTVIN_LEXDEC_COMPACT ?
+            "atoull.bench.compact.csv" : "atoull.bench.csv");
+    if (all || suite == "digits") digitCounts(report, count);
+    if (all || suite == "mixes") mixes(report, count);
+    if (all || suite == "float" || suite == "fixed") {
+        Fields f = prices(count);
+        if (all || suite == "float") {
+            floats<Lettvin::f64t>(report, "f64t", f);
+            floats<Lettvin::f32t>(report, "f32t", f);
+        }
+        if (all || suite == "fixed") fixed(report, f);
+    }
+    if (all || suite == "time") stamps(report, count);
+    if (all || suite == "hex") hex(report, count);
+    if (all || suite == "wide") wide(report, count);
+    if (all || suite == "pressure") pressure(report, count);
+    if (all || suite == "threads") threads(report, count);
+    if (all || suite == "lines") lines(report, 16 * count);
+    if (all || suite == "stream") stream(report, count);
+    if (all || suite == "records") records(report, count);
+    if (all || suite == "format") format(report, count);
+    if (all || suite == "range") range(report, count);
+    if (all || suite == "filter") filter(report, count);
+    if (all || suite == "reduce") reduce(report, count);
+    if (all || suite == "fix") fix(report, count);
+    return 0;
+}
@@ -41,18 +41,135 @@
  * If lexed number falls outside hi lo range, s is unchanged.
  * See UnitTest examples below for edge case analysis.
  * _____________________________________________________________________________
+ * EXAMPLE USAGE: (self-delimiting lexer)
+ *
+ * char source[ ] = "1234,56";
+ * char *s = source;
+ *
+ * target = Lettvin::lexDecU64_Instance.delimited( target, s, error );
+ * target = Lettvin::lexDecU64_Instance.delimited( target, s, error, hi, lo );
+ *
+ * where the digit count is the run of digits at s (here 4, s ends at ',').
+ * An empty run or a run of more than 20 digits sets error.
+ * _____________________________________________________________________________
+ * EXAMPLE USAGE: (floating point lexer)
+ *
+ * char source[ ] = "-1234.5e-3,";
+ * char *s = source;
+ * double price;
+ *
+ * price = Lettvin::lexDecF64_Instance( price, s, error );
+ * price = Lettvin::lexDecF64_Instance( price, s, error, digits );
+ *
+ * where the field is [+-]digits[.digits][(e|E)[+-]digits] and s ends past it.
+ * Given digits, the field must be exactly that long.
+ * Results equal strtod/strtof bit for bit ("C" locale '.').
+ * _____________________________________________________________________________
+ * EXAMPLE USAGE: (fixed-point lexer)
+ *
+ * char source[ ] = "12345.67,";
+ * char *s = source;
+ * long long ticks;   // 1234567000 at scale 10^5
+ *
+ * ticks = Lettvin::lexFixS64_Instance.delimited( ticks, s, error, 5 );
+ * ticks = Lettvin::lexFixS64_Instance( ticks, s, error, 5, 5, 2 );
+ *
+ * where 5 is the scale k and, in the counted form, 5 and 2 are the
+ * integer and fraction digit counts.  More than k fraction digits,
+ * or more than 19 - k integer digits, sets error.
+ * _____________________________________________________________________________
+ * EXAMPLE USAGE: (newline-delimited file)
+ *
+ * std::vector<unsigned long long> column, errors;
+ *
+ * lines = Lettvin::lexLinesU64_Instance.map( path, column, errors, error );
+ *
+ * where column[i] is line i and errors holds the byte offsets of bad lines.
+ * error is set only when the file cannot be opened or mapped.
+ * _____________________________________________________________________________
+ * EXAMPLE USAGE: (decimal writer, the inverse of lexDecU64t)
+ *
+ * char buffer[ 32 ];
+ * char *s = buffer;
+ *
+ * digits = Lettvin::fmtDecU64_Instance( s, target );
+ * digits = Lettvin::fmtDecU64_Instance( s, target, error, 12 );
+ *
+ * where the first writes 1 to 20 digits and the second exactly 12, zero
+ * padded (error if target needs more).  s ends past the digits; no '\0'.
+ * _____________________________________________________________________________
+ * EXAMPLE USAGE: (field width known at compile time)
+ *
+ * Lettvin::lexDecU64< 8 > date;   // e.g. YYYYMMDD in a fixed layout
+ * date( target, s, error );
+ *
+ * where the 8 columns are unrolled with no jump on d; errors, s and the
+ * optional hi/lo bounds behave as in lexDecU64_Instance.
+ * _____________________________________________________________________________
+ * EXAMPLE USAGE: (CSV/TSV rows by column schema)
+ *
+ * typedef Lettvin::lexCsv< Lettvin::recColumn< u64t >, Lettvin::recSkip,
+ *     Lettvin::recColumn< u32t, 100000, 1 > > schema;
+ * schema::table columns;   // std::tuple of one std::vector per column
+ *
+ * rows = schema()( base, size, columns, errors );
+ *
+ * where u32t values outside [1, 100000] are errors and recSkip is ignored.
+ * errors holds the byte offsets of bad fields; bad fields are 0.
+ * _____________________________________________________________________________
+ * EXAMPLE USAGE: (lazy range over a delimited buffer)
+ *
+ * Lettvin::lexRangeU64t values( base, size, ',', &errors );
+ * for ( unsigned long long v : values ) total += v;
+ *
+ * where each value is lexed as the loop reaches it; bad fields are
+ * skipped, counted by values.failed() and their offsets put in errors.
+ * _____________________________________________________________________________
+ * EXAMPLE USAGE: (FIX tag=value messages)
+ *
+ * Lettvin::lexTagValue<> fix;   // one per session, reused per message
+ * fields = fix( message, size, error );
+ * fix.number( quantity, 38, error );
+ * symbol = fix.value( 55, length );
+ *
+ * where a bad field or a wrong tag 10 checksum sets error, with its byte
+ * offset in fix.where(); values point into the message, nothing is copied.
+ * _____________________________________________________________________________
  * METHODS:
  * Pass/return reference prevents data copying and stack construction cost.
  * Jump table eliminates typical switch case cost.
- * JIT (Just-In-Time) jump table filling for first-time cost only.
+ * Jump table built by the compiler: no first-call fill, safe across threads.
  * Jcond use designed to have 0 clock cost due to locality and UV pipes.
  * Prefilled data tables enabling column summing with minimum cost.
+ * SSE4.1/AVX2 kernel, chosen once by CPUID, for fields of 8 or more digits.
+ * -DLETTVIN_LEXDEC_COMPACT=1 swaps the 45 KB tables for 1.8 KB (decCompact).
+ * -DLETTVIN_LEXDEC_STATS=1 counts d and failure kinds per thread (lexStats).
  * _____________________________________________________________________________
  * RESTRICTIONS:
  * Jump table implementation is dependent on g++ syntax/semantics.
+ * Other compilers get the standard C++ switch engine, portable().
+ * Build with -DLETTVIN_LEXDEC_PORTABLE=1 to use it under g++ as well.
+ * Vector kernel may load up to 15 bytes past a short field (never past a page).
+ * Build with -DLETTVIN_LEXDEC_SIMD=0 to use the jump table alone.
  * _____________________________________________________________________________
  * IMPLEMENTED:
  * lexDecU64t: decimal representation into unsigned long long
+ * lexDecU64<W>: lexDecU64t for a width W fixed at compile time, unrolled
+ * lexDec<T>: decimal representation into u08t..s64t (decTable<T, true>)
+ * lexDecU128t: 1 to 39 decimal digits into unsigned __int128 (u128t)
+ * fmtDecU64t: unsigned long long into decimal text, minimal or fixed width
+ * lexDec<F>: decimal floating point into f32t/f64t, correctly rounded
+ * lexFixS64t: fixed-point decimal into s64t scaled by 10^k
+ * lexTimeU64t: "YYYYMMDD-HH:MM:SS[.nnn...]" UTC into u64t epoch nanoseconds
+ * lexHexU64t, lexB36U64t: hexadecimal and base36 into unsigned long long
+ * lexLinesU64t: one number per line, mapped file, parallel, ordered column
+ * lexCacheU64t: lexLinesU64t column kept in a binary sidecar, mapped
+ * lexStreamU64t: pull lexer over an fd or istream in constant memory
+ * lexRecords<Sep, ...>: delimited integer rows into columns (lexCsv, lexTsv)
+ * lexRangeU64t: lazy input range of the values in a delimited buffer
+ * lexFilterU64t: only the values in [lo, hi], out-of-range told from bad
+ * lexAggregateU64t: count, 128-bit sum, min, max, histogram; no column
+ * lexTagValue<Soh, T, F>: FIX tag=value messages, checksum, tag index
  * _____________________________________________________________________________
  * \mainpage Unsigned long long high performance lexer using computed goto.
  * _____________________________________________________________________________
@@ -105,6 +222,348 @@ Illegal request for digit count == 0
                     0                                         0  1 0
  18446744073709551615                      18446744073709551615 20 0
                     0                                         0  1 0
+compact tables: 5120 cases 0 mismatches
+portable engine: 8000 cases 0 mismatches
+vector kernel: 8000 cases 0 mismatches
+threads: 4 x 20000 cases 0 mismatches
+               DELIMITED                  OUT  N E
+                      0,                    0  1 0
+                 123 456                  123  3 0
+   18446744073709551615| 18446744073709551615 20 0
+   18446744073709551616|                    0  0 1
+   00000000000000000001;                    1 20 0
+  000000000000000000001;                    0  0 1
+                      ,1                    0  0 1
+                                            0  0 1
+                      42                   42  2 0
+delimited: 2450 cases 0 mismatches
+column 10: 42 7 100 9999999999 bits 0 errors 0
+column 20: 18446744073709551615 0 0 0 bits 10 errors 2
+column 10 [7,100]: 42 7 100 0 bits 8 errors 1
+column: 6000 cases 0 mismatches
+format: 91740 cases 0 mismatches
+stats: 2 threads 18 calls 0 mismatches
+widths: 16200 cases 0 mismatches
+lexDec<u08t> 3 digits 0..255
+                    0                    0  1 0
+                    7                    7  1 0
+                  255                  255  3 0
+                  256                    0  0 1
+                  999                    0  0 1
+                 1111                    0  0 1
+                   +7                    0  0 1
+                   -0                    0  0 1
+                    -                    0  0 1
+                    0                    0  1 0
+                    1                    1  1 0
+                  12x                    0  0 1
+                   42                    0  0 1
+                   42                   42  2 0
+lexDec<u08t>: 4000 cases 0 mismatches
+lexDec<s08t> 3 digits -128..127
+                    0                    0  1 0
+                    7                    7  1 0
+                  127                  127  3 0
+                  128                    0  0 1
+                  999                    0  0 1
+                 1111                    0  0 1
+                   +7                    7  2 0
+                   -0                    0  2 0
+                    -                    0  0 1
+                 -128                 -128  4 0
+                 -129                    0  0 1
+                  12x                    0  0 1
+                   42                    0  0 1
+                   42                   42  2 0
+lexDec<s08t>: 4000 cases 0 mismatches
+lexDec<u16t> 5 digits 0..65535
+                    0                    0  1 0
+                    7                    7  1 0
+                65535                65535  5 0
+                65536                    0  0 1
+                99999                    0  0 1
+               111111                    0  0 1
+                   +7                    0  0 1
+                   -0                    0  0 1
+                    -                    0  0 1
+                    0                    0  1 0
+                    1                    1  1 0
+                  12x                    0  0 1
+                   42                    0  0 1
+                   42                   42  2 0
+lexDec<u16t>: 4000 cases 0 mismatches
+lexDec<s16t> 5 digits -32768..32767
+                    0                    0  1 0
+                    7                    7  1 0
+                32767                32767  5 0
+                32768                    0  0 1
+                99999                    0  0 1
+               111111                    0  0 1
+                   +7                    7  2 0
+                   -0                    0  2 0
+                    -                    0  0 1
+               -32768               -32768  6 0
+               -32769                    0  0 1
+                  12x                    0  0 1
+                   42                    0  0 1
+                   42                   42  2 0
+lexDec<s16t>: 4000 cases 0 mismatches
+lexDec<u32t> 10 digits 0..4294967295
+                    0                    0  1 0
+                    7                    7  1 0
+           4294967295           4294967295 10 0
+           4294967296                    0  0 1
+           9999999999                    0  0 1
+          11111111111                    0  0 1
+                   +7                    0  0 1
+                   -0                    0  0 1
+                    -                    0  0 1
+                    0                    0  1 0
+                    1                    1  1 0
+                  12x                    0  0 1
+                   42                    0  0 1
+                   42                   42  2 0
+lexDec<u32t>: 4000 cases 0 mismatches
+lexDec<s32t> 10 digits -2147483648..2147483647
+                    0                    0  1 0
+                    7                    7  1 0
+           2147483647           2147483647 10 0
+           2147483648                    0  0 1
+           9999999999                    0  0 1
+          11111111111                    0  0 1
+                   +7                    7  2 0
+                   -0                    0  2 0
+                    -                    0  0 1
+          -2147483648          -2147483648 11 0
+          -2147483649                    0  0 1
+                  12x                    0  0 1
+                   42                    0  0 1
+                   42                   42  2 0
+lexDec<s32t>: 4000 cases 0 mismatches
+lexDec<u64t> 20 digits 0..18446744073709551615
+                    0                    0  1 0
+                    7                    7  1 0
+ 18446744073709551615 18446744073709551615 20 0
+ 18446744073709551616                    0  0 1
+ 99999999999999999999                    0  0 1
+111111111111111111111                    0  0 1
+                   +7                    0  0 1
+                   -0                    0  0 1
+                    -                    0  0 1
+                    0                    0  1 0
+                    1                    1  1 0
+                  12x                    0  0 1
+                   42                    0  0 1
+                   42                   42  2 0
+lexDec<u64t>: 4000 cases 0 mismatches
+lexDec<s64t> 19 digits -9223372036854775808..9223372036854775807
+                    0                    0  1 0
+                    7                    7  1 0
+  9223372036854775807  9223372036854775807 19 0
+  9223372036854775808                    0  0 1
+  9999999999999999999                    0  0 1
+ 11111111111111111111                    0  0 1
+                   +7                    7  2 0
+                   -0                    0  2 0
+                    -                    0  0 1
+ -9223372036854775808 -9223372036854775808 20 0
+ -9223372036854775809                    0  0 1
+                  12x                    0  0 1
+                   42                    0  0 1
+                   42                   42  2 0
+lexDec<s64t>: 4000 cases 0 mismatches
+lexDecU128t 39 digits 0..340282366920938463463374607431768211455
+                                       0  1  1 0
+                                       7  1  1 0
+                     9999999999999999999 19 19 0
+                    18446744073709551616 20 20 0
+  99999999999999999999999999999999999999 38 38 0
+ 340282366920938463463374607431768211455 39 39 0
+                                       0 39  0 1
+                                       0 39  0 1
+                                       0 39  0 1
+                                       0 40  0 1
+                                     120  3  3 0
+                                       0 23  0 1
+                                       0  2  0 1
+                                       0  0  0 0
+lexDecU128t: 4000 cases 0 mismatches
+lexDec<f32t>
+                             0                        0  1 0
+                            -0                       -0  2 0
+                           0.0                        0  3 0
+                    12345.6789         12345.6787109375 10 0
+                   -12345.6789        -12345.6787109375 11 0
+                            .5                      0.5  2 0
+                            5.                        5  2 0
+                        +.5e-3   0.00050000002374872565  6 0
+                          1e23   9.9999997781963084e+22  4 0
+              9007199254740993         9007199254740992 16 0
+                           0.1      0.10000000149011612  3 0
+         3.4028234663852886e38   3.4028234663852886e+38 21 0
+         3.4028235677973366e38   3.4028234663852886e+38 21 0
+        1.7976931348623157e308                        0  0 1
+        1.7976931348623159e308                        0  0 1
+       2.2250738585072014e-308                        0 23 0
+       4.9406564584124654e-324                        0 23 0
+       2.4703282292062327e-324                        0 23 0
+       2.4703282292062328e-324                        0 23 0
+  1.00000005960464477539062499                        1 28 0
+      123456789012345678901234   1.2345678927553945e+23 24 0
+                            1e                        1  1 0
+                           1e+                        1  1 0
+                            1x                        1  1 0
+                             .                        0  0 1
+                             -                        0  0 1
+                            e5                        0  0 1
+                                                      0  0 1
+lexDec<f32t>: 20000 cases 0 mismatches
+lexDec<f64t>
+                             0                        0  1 0
+                            -0                       -0  2 0
+                           0.0                        0  3 0
+                    12345.6789       12345.678900000001 10 0
+                   -12345.6789      -12345.678900000001 11 0
+                            .5                      0.5  2 0
+                            5.                        5  2 0
+                        +.5e-3   0.00050000000000000001  6 0
+                          1e23   9.9999999999999992e+22  4 0
+              9007199254740993         9007199254740992 16 0
+                           0.1      0.10000000000000001  3 0
+         3.4028234663852886e38   3.4028234663852886e+38 21 0
+         3.4028235677973366e38   3.4028235677973366e+38 21 0
+        1.7976931348623157e308  1.7976931348623157e+308 22 0
+        1.7976931348623159e308                        0  0 1
+       2.2250738585072014e-308  2.2250738585072014e-308 23 0
+       4.9406564584124654e-324  4.9406564584124654e-324 23 0
+       2.4703282292062327e-324                        0 23 0
+       2.4703282292062328e-324  4.9406564584124654e-324 23 0
+  1.00000005960464477539062499       1.0000000596046448 28 0
+      123456789012345678901234   1.2345678901234569e+23 24 0
+                            1e                        1  1 0
+                           1e+                        1  1 0
+                            1x                        1  1 0
+                             .                        0  0 1
+                             -                        0  0 1
+                            e5                        0  0 1
+                                                      0  0 1
+lexDec<f64t>: 20000 cases 0 mismatches
+lexFixS64t
+            12345.6789 k 4 i 5 f4            123456789 10 0
+              12345.67 k 4 i 5 f2            123456700  8 0
+           -12345.6789 k 4 i 5 f4           -123456789 11 0
+                 12345 k 4 i 5 f0            123450000  5 0
+                 .6789 k 4 i 0 f4                 6789  5 0
+           12345.67891 k 4 i 5 f5                    0  0 1
+            12345,6789 k 4 i 5 f4                    0  0 1
+            12a45.6789 k 4 i 5 f4                    0  0 1
+            1 345.6789 k 4 i 5 f4                    0  0 1
+            12345.67x9 k 4 i 5 f4                    0  0 1
+  922337203685477.5807 k 4 i15 f4  9223372036854775807 20 0
+  922337203685477.5808 k 4 i15 f4                    0  0 1
+ -922337203685477.5808 k 4 i15 f4 -9223372036854775808 21 0
+ -922337203685477.5809 k 4 i15 f4                    0  0 1
+   9223372036854775807 k 0 i19 f0  9223372036854775807 19 0
+                   1.0 k18 i 1 f1  1000000000000000000  3 0
+                  10.0 k18 i 2 f1                    0  0 1
+            12345.6789 k 4                  123456789 10 0
+                 -0.5, k 4                      -5000  4 0
+                   +7. k 2                        700  3 0
+                7.125x k 2                          0  0 1
+                     . k 2                          0  0 1
+                     - k 2                          0  0 1
+                   42; k 0                         42  2 0
+ -922337203685477.5808 k 4       -9223372036854775808 21 0
+  922337203685477.5808 k 4                          0  0 1
+example 1234567000 8 1234567000 8 0
+lexFixS64t: 11341 cases 0 mismatches
+lexTimeU64t 27 bytes
+           19700101-00:00:00                    0 17 0
+ 19700101-00:00:00.000000001                    1 27 0
+       20000229-12:34:56.789   951827696789000000 21 0
+    20240229-23:59:59.999999  1709251199999999000 24 0
+           21000229-00:00:00                    0  0 1
+           20230431-00:00:00                    0  0 1
+           20231301-00:00:00                    0  0 1
+           20230100-00:00:00                    0  0 1
+           20230101-24:00:00                    0  0 1
+           20230101-23:60:00                    0  0 1
+           20161231-23:59:60  1483228800000000000 17 0
+           20161231-23:59:61                    0  0 1
+           19691231-23:59:59                    0  0 1
+ 25540721-23:34:33.709551615 18446744073709551615 27 0
+ 25540721-23:34:33.709551616                    0  0 1
+           20230101 00:00:00                    0  0 1
+           2023010a-00:00:00                    0  0 1
+          20230101-00:00:00.                    0  0 1
+      20230101-00:00:00.1234                    0  0 1
+       20230101-00:00:00.123                    0  0 0
+       20230101-00:00:00.123  1672531200123000000 21 0
+       20230101-00:00:00.123                    0  0 1
+lexTimeU64t: 40000 cases 0 mismatches
+lexHexU64t 16 digits
+                    0                    0  1 0
+                    7                    7  1 0
+                    a                   10  1 0
+                    Z                    0  0 1
+                    z                    0  0 1
+                   ff                  255  2 0
+                   FF                  255  2 0
+                 fF00                65280  4 0
+                 0x1f                    0  0 1
+                   -1                    0  0 1
+     ffffffffffffffff 18446744073709551615 16 0
+    10000000000000000                    0  0 1
+        3w5e11264sgsf                    0  0 1
+        3w5e11264sgsg                    0  0 1
+        3W5E11264SGSF                    0  0 1
+        4000000000000     1125899906842624 13 0
+     deadbeefcafef00d 16045690984503111693 16 0
+     0000000000000001                    1 16 0
+                 12 4                    0  0 1
+                    g                    0  0 1
+                   ff                    0  0 1
+                   ff                  255  2 0
+lexHexU64t: 6000 cases 0 mismatches
+lexB36U64t 13 digits
+                    0                    0  1 0
+                    7                    7  1 0
+                    a                   10  1 0
+                    Z                   35  1 0
+                    z                   35  1 0
+                   ff                  555  2 0
+                   FF                  555  2 0
+                 fF00               719280  4 0
+                 0x1f                42819  4 0
+                   -1                    0  0 1
+     ffffffffffffffff                    0  0 1
+    10000000000000000                    0  0 1
+        3w5e11264sgsf 18446744073709551615 13 0
+        3w5e11264sgsg                    0  0 1
+        3W5E11264SGSF 18446744073709551615 13 0
+        4000000000000                    0  0 1
+     deadbeefcafef00d                    0  0 1
+     0000000000000001                    0  0 1
+                 12 4                    0  0 1
+                    g                   16  1 0
+                   ff                    0  0 1
+                   ff                    0  0 1
+lexB36U64t: 6000 cases 0 mismatches
+lines: 20000 lines 307 errors 0 mismatches
+lines (mapped): 20000 lines 307 errors 0 mismatches
+cache: 5000 lines 79 errors 0 mismatches
+cache (missing source): e 1 size 0
+stream: 20000 values 289 errors 0 mismatches
+stream (synced): 20000 values 289 errors 0 mismatches
+stream (fd): 20000 values 289 errors 0 mismatches
+records (csv): 3000 rows 449 errors 0 mismatches
+records (tsv): 3000 rows 449 errors 0 mismatches
+range: 19673 values 327 errors 0 mismatches
+filter [1000, 99999]: 530 kept 3534 above 678 below 258 bad 4104 early
+filter: 70000 cases 0 mismatches
+aggregate: 19456 values sum 8:4748774212303664019 min 1
+aggregate: 0 mismatches
+tagvalue: 2000 messages 752 errors 0 mismatches
 atoull.h.cpp May  8 2008 10:41:59 UNIT TEST: ends Alternate style
 )expect";
 ///////////////////////////////////////////////////////////////////////////////
@@ -115,6 +574,7 @@ atoull.h.cpp May  8 2008 10:41:59 UNIT TEST: ends Alternate style
 #ifndef LETTVIN_LEXERS_H_CPP
 #define LETTVIN_LEXERS_H_CPP
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <fstream>
@@ -122,6 +582,68 @@ atoull.h.cpp May  8 2008 10:41:59 UNIT TEST: ends Alternate style
 #include <iomanip>
 #include <exception>
 #include <cstring>
+#include <cctype>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <limits>
+#include <type_traits>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <tuple>
+#include <iterator>
+#include <numeric>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#ifdef LETTVIN_LEXERS_H_CPP_UNIT
+#include <ctime>
+#include <mutex>
+#endif
+
+/// @brief Scalar engine selection: 1 uses portable() instead of computed goto
+#ifndef LETTVIN_LEXDEC_PORTABLE
+#ifdef __GNUC__
+#define LETTVIN_LEXDEC_PORTABLE 0
+#else
+#define LETTVIN_LEXDEC_PORTABLE 1
+#endif
+#endif
+
+/// @brief x86-64 vector kernel selection (0 disables, see RESTRICTIONS)
+#ifndef LETTVIN_LEXDEC_SIMD
+#if defined(__GNUC__) && defined(__x86_64__)
+#define LETTVIN_LEXDEC_SIMD 1
+#else
+#define LETTVIN_LEXDEC_SIMD 0
+#endif
+#endif
+
+/// @brief lexDecU64t table layout: 1 uses the 1.8 KB decCompact tables
+#ifndef LETTVIN_LEXDEC_COMPACT
+#define LETTVIN_LEXDEC_COMPACT 0
+#endif
+
+/// @brief lexDecU64t counters: 1 keeps lexStats (see lexStats::snapshot)
+#ifndef LETTVIN_LEXDEC_STATS
+#define LETTVIN_LEXDEC_STATS 0
+#endif
+
+#if LETTVIN_LEXDEC_STATS
+#include <mutex>
+#endif
+
+#if LETTVIN_LEXDEC_SIMD
+#include <immintrin.h>
+#define LETTVIN_UNSANITIZED __attribute__((no_sanitize_address))
+#else
+#define LETTVIN_UNSANITIZED
+#endif
 
 namespace Lettvin {
 
@@ -160,12 +682,18 @@ namespace Lettvin {
     typedef             double  f64t, *f64p, &f64r, *&f64pr;
     typedef              float  f32t, *f32p, &f32r, *&f32pr;
 
+#ifdef __SIZEOF_INT128__
+    /// GCC and Clang on 64 bit targets; lexDecU128t exists only with it.
+    __extension__ typedef unsigned __int128 u128t, *u128p, &u128r, *&u128pr;
+#endif
+
     /// Until the long double size issue is addressed, 10 lexers must be made.
     /// One each: u08t, s08t, u16t, s16t, u32t, s32t, u64t, s64t, f32t, f64t.
     /// After addressing long doubles, one lexer for each size will be made
     /// for each useful representation such as decimal, base36.
-    /// Other representations such as binary, octal, hexadecimal are ignored
-    /// since use in financial data hasn't yet been established in FE-DEV.
+    /// Hexadecimal (order IDs) and base36 (symbol codes) exist for u64t;
+    /// binary and octal are ignored since use in financial data hasn't
+    /// yet been established in FE-DEV.
 
     /// Examine sample output above to observe what this pair of macros do.
     /// CONFIRM_DATA_SIZE  enforces that data types have the specified size.
@@ -201,7 +729,624 @@ namespace Lettvin {
 
 #endif  // LETTVIN_TYPES
 
-class lexDecU64t {
+    ///########################################################################
+    /// Compile-time tables for the decimal lexers of every integral type T.
+    /// U holds a magnitude, D is the most digits a value of T can have and
+    /// top the largest magnitude: max for unsigned T, |min| for signed T.
+    /// Row n of col holds each digit times 10^n and row n of inv flags the
+    /// digits no value can have in column n; only the top column, which is
+    /// limited to the digit high, has any.  A non-digit byte has value 0;
+    /// it is flagged in every row only in a strict table (S), as lexDec<T>
+    /// uses.  lexDecU64t and the lexers bit-identical to it keep the
+    /// unflagged tables, where a non-digit counts as a 0 digit.
+    /// indices and buildIndices stand in for C++14 std::index_sequence;
+    /// each table is one flat pack of D * 256 entries.
+    template <size_t... I> struct indices {};
+
+    template <class A, class B> struct catIndices;
+    template <size_t... I, size_t... J>
+    struct catIndices<indices<I...>, indices<J...> > {
+        typedef indices<I..., (sizeof...(I) + J)...> type;
+    };
+
+    template <size_t N> struct buildIndices {
+        typedef typename catIndices<
+            typename buildIndices<N / 2>::type,
+            typename buildIndices<N - N / 2>::type>::type type;
+    };
+    template <> struct buildIndices<0> { typedef indices<> type; };
+    template <> struct buildIndices<1> { typedef indices<0> type; };
+
+    constexpr size_t decDigits(u64t x) {
+        return x < 10 ? 1 : 1 + decDigits(x / 10);
+    }
+    constexpr u64t decPower(size_t n) { return n ? 10 * decPower(n - 1) : 1; }
+
+    /// Leading zero bits of w != 0, with the builtin where GCC and Clang
+    /// have one and a shift loop elsewhere (MSVC, strict ISO).
+    inline int bitClz(u64t w) {
+#ifdef __GNUC__
+        return __builtin_clzll(w);
+#else
+        int n = 0;
+        while (!(w & (1ULL << 63))) w <<= 1, ++n;
+        return n;
+#endif
+    }
+
+    /// Trailing zero bits of w != 0, and the bits set in w, likewise.
+    inline int bitCtz(u64t w) {
+#ifdef __GNUC__
+        return __builtin_ctzll(w);
+#else
+        int n = 0;
+        while (!(w & 1)) w >>= 1, ++n;
+        return n;
+#endif
+    }
+
+    inline int bitCount(u64t w) {
+#ifdef __GNUC__
+        return __builtin_popcountll(w);
+#else
+        int n = 0;
+        for (; w; w &= w - 1) ++n;
+        return n;
+#endif
+    }
+
+    template <typename T> struct decLimits {
+        typedef typename std::make_unsigned<T>::type U;
+        static constexpr bool sign = std::numeric_limits<T>::is_signed;
+        static constexpr U top = sign ?
+            U(std::numeric_limits<T>::max()) + 1 :
+            std::numeric_limits<U>::max();
+        static constexpr size_t D = decDigits(top);
+        static constexpr u64t high = top / decPower(D - 1);
+    };
+
+    template <typename T, bool S>
+    constexpr bool decInvalid(size_t i) {
+        return i % 256 - '0' < 10 ? i / 256 == decLimits<T>::D - 1 &&
+            i % 256 - '0' > decLimits<T>::high : S;
+    }
+    template <typename T>
+    constexpr typename decLimits<T>::U decValue(size_t i) {
+        return i % 256 - '0' < 10 ? typename decLimits<T>::U(
+                (i % 256 - '0') * decPower(i / 256)) : 0;
+    }
+
+    template <typename T, bool S = false, typename I =
+        typename buildIndices<decLimits<T>::D * 256>::type>
+    struct decTable;
+
+    template <typename T, bool S, size_t... I>
+    struct decTable<T, S, indices<I...> > : decLimits<T> {
+        /// Invalid character table
+        static constexpr bool inv[decLimits<T>::D][256] = {
+            decInvalid<T, S>(I)... };
+        /// column-value lookup table
+        static constexpr typename decLimits<T>::U col[decLimits<T>::D][256] = {
+            decValue<T>(I)... };
+    };
+
+    template <typename T, bool S, size_t... I>
+    constexpr bool decTable<T, S, indices<I...> >::inv[decLimits<T>::D][256];
+    template <typename T, bool S, size_t... I>
+    constexpr typename decLimits<T>::U
+        decTable<T, S, indices<I...> >::col[decLimits<T>::D][256];
+    template <typename T> constexpr bool decLimits<T>::sign;
+    template <typename T> constexpr typename decLimits<T>::U decLimits<T>::top;
+    template <typename T> constexpr size_t decLimits<T>::D;
+    template <typename T> constexpr u64t decLimits<T>::high;
+
+    ///########################################################################
+    /// Compact alternative to decTable<u64t> for lexDecU64t: cls maps a
+    /// byte to its digit, folding the '0' offset subtract and the rule
+    /// that a non-digit counts as 0 into one 256 byte row, and val holds
+    /// each digit times 10^n in 20 rows of 10.  The top column's limit is
+    /// tested on the digit itself.  1856 bytes against 46080 for col and
+    /// inv, so lexing leaves the L1 to its caller's data.
+    template <typename C = buildIndices<256>::type,
+              typename V = buildIndices<200>::type>
+    struct decCompact;
+
+    template <size_t... C, size_t... V>
+    struct decCompact<indices<C...>, indices<V...> > {
+        static constexpr u08t cls[256] = {
+            u08t(C - '0' < 10 ? C - '0' : 0)... };
+        static constexpr u64t val[20][10] = {
+            u64t(V % 10 * decPower(V / 10))... };
+    };
+
+    template <size_t... C, size_t... V>
+    constexpr u08t decCompact<indices<C...>, indices<V...> >::cls[256];
+    template <size_t... C, size_t... V>
+    constexpr u64t decCompact<indices<C...>, indices<V...> >::val[20][10];
+
+    ///########################################################################
+    /// Compile-time tables for the u64t lexers in base B (16 and 36), laid
+    /// out as decTable: row n of col holds each digit times B^n and row n
+    /// of inv flags what column n cannot hold.  Digits are 0-9 then a-z in
+    /// either case.  Unlike the decimal tables, a byte that is not a digit
+    /// of base B is flagged in every column, so where strtoull stops
+    /// quietly these lexers report the field as an error.
+    constexpr u64t radDigit(size_t c) {
+        return c - '0' < 10 ? c - '0' :
+               c - 'a' < 26 ? c - 'a' + 10 :
+               c - 'A' < 26 ? c - 'A' + 10 : 36;
+    }
+    constexpr size_t radDigits(u64t x, u64t B) {
+        return x < B ? 1 : 1 + radDigits(x / B, B);
+    }
+    constexpr u64t radPower(u64t B, size_t n) {
+        return n ? B * radPower(B, n - 1) : 1;
+    }
+
+    template <u64t B> struct radLimits {
+        static constexpr u64t top = ~0ULL;
+        static constexpr size_t D = radDigits(top, B);
+        static constexpr u64t high = top / radPower(B, D - 1);
+    };
+
+    template <u64t B>
+    constexpr bool radInvalid(size_t i) {
+        return radDigit(i % 256) >= B ||
+            (i / 256 == radLimits<B>::D - 1 &&
+             radDigit(i % 256) > radLimits<B>::high);
+    }
+    template <u64t B>
+    constexpr u64t radValue(size_t i) {
+        return radDigit(i % 256) < B ?
+            radDigit(i % 256) * radPower(B, i / 256) : 0;
+    }
+
+    template <u64t B, typename I =
+        typename buildIndices<radLimits<B>::D * 256>::type>
+    struct radTable;
+
+    template <u64t B, size_t... I>
+    struct radTable<B, indices<I...> > : radLimits<B> {
+        /// Invalid character table
+        static constexpr bool inv[radLimits<B>::D][256] = {
+            radInvalid<B>(I)... };
+        /// column-value lookup table
+        static constexpr u64t col[radLimits<B>::D][256] = {
+            radValue<B>(I)... };
+    };
+
+    template <u64t B, size_t... I>
+    constexpr bool radTable<B, indices<I...> >::inv[radLimits<B>::D][256];
+    template <u64t B, size_t... I>
+    constexpr u64t radTable<B, indices<I...> >::col[radLimits<B>::D][256];
+    template <u64t B> constexpr u64t radLimits<B>::top;
+    template <u64t B> constexpr size_t radLimits<B>::D;
+    template <u64t B> constexpr u64t radLimits<B>::high;
+
+    ///########################################################################
+    /// Tables for fmtDecU64t: pair holds "00" to "99" so that two digits
+    /// are written by one 2 byte copy, and power holds 10^0 to 10^19.
+    template <typename I = buildIndices<200>::type,
+              typename P = buildIndices<20>::type>
+    struct decPairs;
+
+    template <size_t... I, size_t... P>
+    struct decPairs<indices<I...>, indices<P...> > {
+        static constexpr char pair[200] = {
+            char('0' + (I % 2 ? I / 2 % 10 : I / 20))... };
+        static constexpr u64t power[20] = { decPower(P)... };
+    };
+
+    template <size_t... I, size_t... P>
+    constexpr char decPairs<indices<I...>, indices<P...> >::pair[200];
+    template <size_t... I, size_t... P>
+    constexpr u64t decPairs<indices<I...>, indices<P...> >::power[20];
+
+    ///########################################################################
+    /// Decimal writer, the inverse of lexDecU64t, into a caller's buffer
+    /// with no allocation and no locale.  The value is cut into 8 digit
+    /// chunks, so the divisions are 32 bit multiplies, and each chunk is
+    /// written two digits at a time from decPairs<>::pair.  The minimal
+    /// form shifts its leading chunk in a register to drop the leading
+    /// zeros, so there is no loop over the digit count.
+    ///
+    /// fmtDecU64_Instance( s, v );           // minimal: "0" .. 20 digits
+    /// fmtDecU64_Instance( s, v, error, d ); // exactly d digits, 0 padded
+    ///
+    /// s ends past what was written, and the digit count is returned.
+    /// The minimal form may store up to 8 bytes past its digits (never
+    /// past s + 20), so it needs 20 bytes of room; the fixed forms write
+    /// exactly their d digits, so records can be filled in place.  The
+    /// fixed form follows the lexer's contract: nothing is written when
+    /// e is already set, and e is set, with nothing written, when v needs
+    /// more than d digits or d is 0 or over 20.  Neither form writes a
+    /// terminator.
+    class fmtDecU64t {
+     public:
+        inline size_t operator()(s08pr s, u64t v) {
+            const size_t d = digits(v);
+            write(s, v, d);
+            s += d;
+            return d;
+        }
+
+        inline size_t operator()(s08pr s, u64t v, u64t &e,  // NOLINT
+                size_t d) {
+            if ((e |= (d - 1 >= 20 || digits(v) > d))) return 0;
+            put(s + d, v, d);
+            s += d;
+            return d;
+        }
+
+        /// Digits in the minimal form of v: 1 for 0, 20 above 10^19 - 1.
+        /// The bit length times log10(2) (1233 / 4096) is the count or one
+        /// more, settled by one compare with a power of 10.
+        static inline size_t digits(u64t v) {
+            const size_t t = ((64 - bitClz(v | 1)) * 1233) >> 12;
+            return t + 1 - (t && v < decPairs<>::power[t]);
+        }
+
+        /// Batch form for fixed-width records, the inverse of
+        /// lexDecU64t::column(): write in[i] in width digits at base +
+        /// offset + i * stride.  Bit i of the caller's bits[(count + 63)
+        /// / 64] is set, and the field left as it was, when in[i] needs
+        /// more than width digits; a width of 0 or over 20 fails all.
+        /// Returns the number of fields in error.
+        size_t column(
+                char *base,
+                size_t stride,
+                size_t offset,
+                size_t width,
+                size_t count,
+                const u64t *in,
+                u64p bits) {
+            char *p = base + offset;
+            switch (width) {
+#define FMTU64ROWS(w) case w: return rows<w>(p, stride, count, in, bits)
+        FMTU64ROWS(1);  FMTU64ROWS(2);  FMTU64ROWS(3);  FMTU64ROWS(4);
+        FMTU64ROWS(5);  FMTU64ROWS(6);  FMTU64ROWS(7);  FMTU64ROWS(8);
+        FMTU64ROWS(9);  FMTU64ROWS(10); FMTU64ROWS(11); FMTU64ROWS(12);
+        FMTU64ROWS(13); FMTU64ROWS(14); FMTU64ROWS(15); FMTU64ROWS(16);
+        FMTU64ROWS(17); FMTU64ROWS(18); FMTU64ROWS(19); FMTU64ROWS(20);
+            }
+            for (size_t i = 0; i < count; i += 64) {
+                bits[i / 64] = count - i < 64 ?
+                    (1ULL << (count - i)) - 1 : ~0ULL;
+            }
+            return count;
+        }
+
+        /// Batch form for delimited text: write each of in[0, count) in
+        /// its minimal form followed by sep; s ends past the last sep.
+        /// Needs room for 21 bytes a value.  Returns the bytes written.
+        size_t delimited(s08pr s, const u64t *in, size_t count,
+                char sep = '\n') {
+            char *o = s;
+            for (size_t i = 0; i < count; ++i) {
+                (*this)(s, in[i]);
+                *s++ = sep;
+            }
+            return s - o;
+        }
+
+     private:
+        /// Records for one width W, 64 to each word of bits.
+        template <size_t W>
+        static size_t rows(char *p, size_t stride, size_t count,
+                const u64t *in, u64p bits) {
+            size_t errors = 0;
+            for (size_t i = 0; i < count; i += 64) {
+                const size_t n = count - i < 64 ? count - i : 64;
+                u64t word = 0;
+                for (size_t j = 0; j < n; ++j) {
+                    const u64t v = in[i + j];
+                    const bool no = W < 20 && v >= decPairs<>::power[W % 20];
+                    if (!no) put(p + (i + j) * stride + W, v, W);
+                    word |= u64t(no) << j;
+                    errors += no;
+                }
+                bits[i / 64] = word;
+            }
+            return errors;
+        }
+
+        /// Write the d digits of v, minimal, at s (see head()).
+        static inline void write(char *s, u64t v, size_t d) {
+            if (d <= 8) return head(s, u32t(v), d);
+            const u64t q = v / 100000000ULL;
+            const u32t lo = u32t(v - q * 100000000ULL);
+            if (d <= 16) {
+                head(s, u32t(q), d - 8);
+            } else {
+                const u64t h = q / 100000000ULL;
+                head(s, u32t(h), d - 16);
+                eight(s + d - 16, u32t(q - h * 100000000ULL));
+            }
+            eight(s + d - 8, lo);
+        }
+
+        /// Write exactly the d digits of v, zero padded, ending at end.
+        static inline void put(char *end, u64t v, size_t d) {
+            for (; d > 8; d -= 8) {
+                const u64t q = v / 100000000ULL;
+                eight(end -= 8, u32t(v - q * 100000000ULL));
+                v = q;
+            }
+            u32t w = u32t(v);
+            for (; d >= 2; d -= 2) {
+                const u32t q = w / 100;
+                memcpy(end -= 2, &decPairs<>::pair[2 * (w - 100 * q)], 2);
+                w = q;
+            }
+            if (d) *--end = char('0' + w);
+        }
+
+        /// Write the last d (1 to 8) of the 8 digits of w at s.  Where the
+        /// byte order is known all 8 bytes are stored, with one shift;
+        /// whatever follows the d digits is overwritten next.
+        static inline void head(char *s, u32t w, size_t d) {
+            char t[8];
+            eight(t, w);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            u64t x;
+            memcpy(&x, t, 8);
+            x >>= 8 * (8 - d);
+            memcpy(s, &x, 8);
+#elif defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            u64t x;
+            memcpy(&x, t, 8);
+            x <<= 8 * (8 - d);
+            memcpy(s, &x, 8);
+#else
+            memcpy(s, t + 8 - d, d);
+#endif
+        }
+
+        /// Write the 8 digits of w < 10^8 at p.
+        static inline void eight(char *p, u32t w) {
+            const u32t hi = w / 10000, lo = w - 10000 * hi;
+            memcpy(p, &decPairs<>::pair[2 * (hi / 100)], 2);
+            memcpy(p + 2, &decPairs<>::pair[2 * (hi % 100)], 2);
+            memcpy(p + 4, &decPairs<>::pair[2 * (lo / 100)], 2);
+            memcpy(p + 6, &decPairs<>::pair[2 * (lo % 100)], 2);
+        }
+    };
+
+    static fmtDecU64t fmtDecU64_Instance;
+
+    ///########################################################################
+    /// Counts kept by lexDecU64t::operator() when built with
+    /// -DLETTVIN_LEXDEC_STATS=1, to tell a change in the digit count mix
+    /// from a rise in each kind of failure.  Each thread counts into its
+    /// own cell with plain stores; snapshot() adds up every cell, live or
+    /// from threads that have exited, so a service can export it now and
+    /// then and difference the totals.  Calls made once e is already set
+    /// do no lexing and are not counted.  Built without the macro,
+    /// nothing is counted, operator() is unchanged and snapshot() is 0.
+    struct lexStats {
+        u64t d[22];     ///< calls by requested d; d[21] counts d > 20
+        u64t invalid;   ///< top column digit above 1 (inv[][] flagged)
+        u64t overflow;  ///< value above 18446744073709551615
+        u64t above;     ///< value above hi
+        u64t below;     ///< value below lo
+        u64t width;     ///< d over 20
+
+        lexStats() : invalid(0), overflow(0), above(0), below(0), width(0) {
+            for (size_t i = 0; i < 22; ++i) d[i] = 0;
+        }
+
+        lexStats &merge(const lexStats &o) {
+            for (size_t i = 0; i < 22; ++i) d[i] += o.d[i];
+            invalid += o.invalid;
+            overflow += o.overflow;
+            above += o.above;
+            below += o.below;
+            width += o.width;
+            return *this;
+        }
+
+        static lexStats snapshot();   ///< every thread so far
+        static lexStats thread();     ///< the calling thread
+    };
+
+#if LETTVIN_LEXDEC_STATS
+    /// One thread's lexStats.  Only the owning thread writes, with a
+    /// relaxed load and store (a plain increment, no locked instruction);
+    /// readers on other threads see whole values.  Cells register on
+    /// first use and fold into retired() when their thread exits.
+    class lexStatsCell {
+     public:
+        std::atomic<u64t> d[22], invalid, overflow, above, below, width;
+
+        static lexStatsCell &local() {
+            static thread_local lexStatsCell cell;
+            return cell;
+        }
+
+        static inline void add(std::atomic<u64t> &c) {  // NOLINT
+            c.store(c.load(std::memory_order_relaxed) + 1,
+                    std::memory_order_relaxed);
+        }
+
+        void read(lexStats &s) const {  // NOLINT
+            for (size_t i = 0; i < 22; ++i) s.d[i] = get(d[i]);
+            s.invalid = get(invalid);
+            s.overflow = get(overflow);
+            s.above = get(above);
+            s.below = get(below);
+            s.width = get(width);
+        }
+
+        /// Sum of every live cell and every retired one.
+        static lexStats total() {
+            std::lock_guard<std::mutex> hold(lock());
+            lexStats sum = retired(), one;
+            for (size_t i = 0; i < live().size(); ++i) {
+                live()[i]->read(one);
+                sum.merge(one);
+            }
+            return sum;
+        }
+
+     private:
+        lexStatsCell() {
+            for (size_t i = 0; i < 22; ++i) d[i] = 0;
+            invalid = overflow = above = below = width = 0;
+            std::lock_guard<std::mutex> hold(lock());
+            live().push_back(this);
+        }
+
+        ~lexStatsCell() {
+            std::lock_guard<std::mutex> hold(lock());
+            lexStats mine;
+            read(mine);
+            retired().merge(mine);
+            std::vector<lexStatsCell *> &all = live();
+            all.erase(std::find(all.begin(), all.end(), this));
+        }
+
+        static u64t get(const std::atomic<u64t> &c) {
+            return c.load(std::memory_order_relaxed);
+        }
+
+        static std::mutex &lock() {
+            static std::mutex m;
+            return m;
+        }
+        static std::vector<lexStatsCell *> &live() {
+            static std::vector<lexStatsCell *> cells;
+            return cells;
+        }
+        static lexStats &retired() {
+            static lexStats gone;
+            return gone;
+        }
+    };
+
+    inline lexStats lexStats::snapshot() { return lexStatsCell::total(); }
+
+    inline lexStats lexStats::thread() {
+        lexStats s;
+        lexStatsCell::local().read(s);
+        return s;
+    }
+#else
+    inline lexStats lexStats::snapshot() { return lexStats(); }
+    inline lexStats lexStats::thread() { return lexStats(); }
+#endif
+
+/// Inlining that the unrolled lexDecU64<W> columns must get whatever the
+/// compiler's size budget, as the fall-through columns always did.
+#ifdef __GNUC__
+#define LETTVIN_INLINE inline __attribute__((always_inline))
+#else
+#define LETTVIN_INLINE inline
+#endif
+
+/// An intended fall through to the next case of an unrolled switch.  A
+/// "// FALLTHROUGH" comment does not reach GCC's -Wimplicit-fallthrough
+/// there, as the case labels come from a macro.
+#if __cplusplus >= 201703L
+#define LETTVIN_FALLTHROUGH [[fallthrough]]
+#elif defined(__GNUC__) && __GNUC__ >= 7
+#define LETTVIN_FALLTHROUGH __attribute__((fallthrough))
+#else
+#define LETTVIN_FALLTHROUGH
+#endif
+
+/// Column lookups of lexDecU64t's engines in the selected table layout.
+#if LETTVIN_LEXDEC_COMPACT
+#define DECU64DIG decCompact<>::cls[static_cast<u08t>(*s)]
+#define DECU64INV(n) (n == 19 && DECU64DIG > 1)
+#define DECU64COL(n) decCompact<>::val[n][DECU64DIG]
+#else
+#define DECU64INV(n) inv[n][static_cast<u08t>(*s)]
+#define DECU64COL(n) col[n][static_cast<u08t>(*s)]
+#endif
+
+    ///########################################################################
+    /// lexDecU64<W>: lexDecU64t for a field width W (1..20) fixed at
+    /// compile time, as in a record layout:
+    ///
+    /// lexDecU64<8> date;
+    /// date(v, s, e);            // or lexDecU64<8>::lex(v, s, e, hi, lo)
+    ///
+    /// The W columns are unrolled from the template, so there is no
+    /// indirect jump, no d > 20 test and no table to set up at run time;
+    /// e, s, hi and lo behave as in lexDecU64t.  column<N>() is the one
+    /// column step of every lexDecU64t engine: the runtime-d entry
+    /// points dispatch on d to these instances.  Being scalar, it is
+    /// the faster form below 8 digits; from 8 up, where the vector
+    /// kernel takes over, lexDecU64t(v, s, e, W) is.
+    template <size_t W>
+    class lexDecU64 : private decTable<u64t> {
+     public:
+        static_assert(W >= 1 && W <= 20, "lexDecU64t lexes 1 to 20 digits");
+
+        inline u64t &operator()(
+                u64r ull, s08pr s, u64t &e,                         // NOLINT
+                u64t r = decLimits<u64t>::top, u64t b = 0) const {
+            return lex(ull, s, e, r, b);
+        }
+
+        static LETTVIN_INLINE u64t &lex(
+                u64r ull, s08pr s, u64t &e,                         // NOLINT
+                u64t r, u64t b) {
+            s08p o = s;
+            ull = 0;
+            if (!e) {
+                if (chain(ull, s, r, typename buildIndices<W>::type()) &&
+                        ull >= b)     ///< See if value fell below minimum
+                    return ull;
+                e = 1;
+            }
+            s = o;                ///< On failure, restore the pointer
+            return ull = 0;
+        }
+
+        /// Column N (digit weight 10^N) at s: check for a forbidden digit
+        /// (inv[][]), then for overflow of the remainder r; if neither,
+        /// reduce r, add the column and advance s.
+        template <size_t N>
+        static LETTVIN_INLINE bool column(
+                u64r ull, s08pr s, u64t &r) {                       // NOLINT
+            u64t t;
+            if (DECU64INV(N) || (t = DECU64COL(N)) > r) return false;
+            r -= t;
+            ull += t;
+            ++s;
+            return true;
+        }
+
+     private:
+        /// Columns W-1 down to 0, each failure branching straight out
+        /// as the fall-through switch cases did.
+        template <size_t I, size_t... J>
+        static LETTVIN_INLINE bool chain(
+                u64r ull, s08pr s, u64t &r,                         // NOLINT
+                indices<I, J...>) {
+            return column<W - 1 - I>(ull, s, r) &&
+                chain(ull, s, r, indices<J...>());
+        }
+        static LETTVIN_INLINE bool chain(
+                u64r, s08pr, u64t &, indices<>) {                   // NOLINT
+            return true;
+        }
+    };
+
+    ///########################################################################
+    /// The vector kernel lexDecU64t chose by CPUID: a static of a class
+    /// template, as in decPairs<>, so that every translation unit
+    /// including this header shares one definition.  It is set after
+    /// lexDecU64t is complete, and a lexer run before that (from another
+    /// static initializer) finds it null and takes the jump table.
+    template <typename T = void> struct decKernel {
+        typedef u64t &(*kernel_t)(u64r, s08pr, u64t &,              // NOLINT
+                                  size_t, u64t, u64t);
+        static kernel_t kernel;  ///< CPUID choice; null: jump table only
+    };
+
+class lexDecU64t : private decTable<u64t>, public decKernel<> {
  public:
             inline u64t &
                 operator()(
@@ -212,51 +1357,74 @@ class lexDecU64t {
                         u64t r = top,
                         u64t b = zip
                         ) {
-#ifndef __GNUC__
+#if LETTVIN_LEXDEC_STATS
+                    note counted(*this, s, e, d, r, b);
+#endif
+#if LETTVIN_LEXDEC_PORTABLE
+#if LETTVIN_LEXDEC_SIMD
+                    if (!e && d >= 8 && d <= 20 && kernel &&
+                            (d >= 16 || paged(s)))
+                        return kernel(ull, s, e, d, r, b);
+#endif
+                    return portable(ull, s, e, d, r, b);
+#else
+                    /// Column-count jump table, built by the compiler from
+                    /// label addresses: no first-call fill, nothing for
+                    /// threads to race on, and no hot-path test.  It is
+                    /// read-only data on lines of its own, so no mutable
+                    /// neighbour shares them.  d == 0 fails like d > 20.
+                    alignas(64) static void *const DIGITS[21] = { && err,
+#if Alternate
+                        && c0,  && c1,  && c2,  && c3,  && c4,  && c5,
+                        && c6,  && c7,  && c8,  && c9,  && c10, && c11,
+                        && c12, && c13, && c14, && c15, && c16, && c17,
+                        && c18, && c19 };
 #else
-                    static void *DIGITS[256];   /// column-count jump table
+                        && c00, && c01, && c02, && c03, && c04, && c05,
+                        && c06, && c07, && c08, && c09, && c10, && c11,
+                        && c12, && c13, && c14, && c15, && c16, && c17,
+                        && c18, && c19 };
+#endif
                     s08p o = s;
 
                     /// Do not perform this function
                     /// if a prior error has been detected.
                     if ((e |= (d > 20))) goto err;
-                    if (!DIGITS[0]) goto fill;
-                    ull = zip;
-                    u64t t;    /// temporary column value
-                    // std::cout << std::endl << s << ":" << *s << std::endl;
+#if LETTVIN_LEXDEC_SIMD
+                    /// Long fields go to the vector kernel when the CPU
+                    /// has one and a 16 byte load cannot cross a page.
+                    if (d >= 8 && kernel && (d >= 16 || paged(s)))
+                        return kernel(ull, s, e, d, r, b);
+#endif
 
-run:    goto *(DIGITS[d]);
+        goto *(DIGITS[d]);
         ///********************************************************************
         /// Failure is slightly more expensive than success, as it should be.
         /// since the JC, JNC family consume 0 clocks if branch is not taken.
         /// This is a property of Intel iAPX86 prefetch queues and UV pipes.
-        /// So, once the initialization takes place, this is 0 cost.
+        /// DIGITS is constant data, so the dispatch is one indirect jump.
         /// Calculate number for the precise number of digits requested.
         /// This table of addresses permits inexpensive bypassing of
         /// unnecessary branchings and calculations.
         /// Idea: accumulate digits in each x10 column of the target number.
-        /// Breakdown of operations in the next 20 lines:
+        /// Each label below returns through lexDecU64<n + 1>, whose
+        /// unrolled column() steps are broken down here:
         /// s is a pointer to the current character to lex.
         /// *s fetches that character.
         /// col[ 17 ][ *s ] indexes into the 17th table of 256 u64t values.
         ///********************************************************************
-        /// HOW TO READ THESE LINES:
-        /// If not error
+        /// HOW TO READ A COLUMN:
         /// Check to see if this digit is forbidden in this column
         ///   Any digit other than 0 or 1 in column index 19 is forbidden.
         ///   This is because 0xFFFFFFFFFFFFFFFFULL == 18446744073709551615
         ///   so the most significant digit must never be greater than 1.
-        ///   It is also because a non-digit should cause an error.
+        ///   A non-digit is not flagged here: it counts as a 0 digit.
         /// If not, check to see if digit would overflow the remainder
         /// If not, reduce remainder, add digit in column and advance pointer.
         ///********************************************************************
 #if Alternate
 #define DECU64COLUMN(n) \
-        c##n: \
-        e || \
-        (e|=inv[n][static_cast<int>(*s)]) || \
-        (e|=((t=col[n][static_cast<int>(*s)]) > r)) || \
-        ((r-=t), (ull+=t), (++s))
+        c##n: return lexDecU64<n + 1>::lex(ull, s, e, r, b)
         DECU64COLUMN(19);
         DECU64COLUMN(18);
         DECU64COLUMN(17);
@@ -278,11 +1446,8 @@ run:    goto *(DIGITS[d]);
         DECU64COLUMN(1);
         DECU64COLUMN(0);
 #else
-#define DECU64COLPN(p, n) c##p##n: \
-        e || \
-        (e|=inv[n][static_cast<int>(*s)]) || \
-        (e|=((t=col[n][static_cast<int>(*s)]) > r)) || \
-        ((r-=t), (ull+=t), (++s))
+#define DECU64COLPN(p, n) \
+        c##p##n: return lexDecU64<p * 10 + n + 1>::lex(ull, s, e, r, b)
 
         DECU64COLPN(1, 9);
         DECU64COLPN(1, 8);
@@ -305,66 +1470,123 @@ run:    goto *(DIGITS[d]);
         DECU64COLPN(0, 1);
         DECU64COLPN(0, 0);
 #endif
-        e |= (ull < b);       ///< See if value fell below minimum
-        if (!e) return ull;    ///< This return bypasses any further execution
 err:    s = o;              ///< On failure, restore the pointer
         return ull = zip;       ///< This return took extra instructions
-fill:
-        /// For the cost of expanding 20 instructions
-        /// the initialization of the inlined jump table is available
-        /// to be performed by every potential client for its own table.
-        /// In the style of JIT compilation, this is performed
-        /// the first time through any client call of this code.
-        for (size_t i = 0; i < 256; ++i) DIGITS[i] = && err;
-#if Alternate
-#define DECU64DIGITS(n) \
-        DIGITS[ n+1 ] = && c##n
-        DECU64DIGITS(19);
-        DECU64DIGITS(18);
-        DECU64DIGITS(17);
-        DECU64DIGITS(16);
-        DECU64DIGITS(15);
-        DECU64DIGITS(14);
-        DECU64DIGITS(13);
-        DECU64DIGITS(12);
-        DECU64DIGITS(11);
-        DECU64DIGITS(10);
-        DECU64DIGITS(9);
-        DECU64DIGITS(8);
-        DECU64DIGITS(7);
-        DECU64DIGITS(6);
-        DECU64DIGITS(5);
-        DECU64DIGITS(4);
-        DECU64DIGITS(3);
-        DECU64DIGITS(2);
-        DECU64DIGITS(1);
-        DECU64DIGITS(0);
+#endif
+                }
+
+            /// Standard C++ engine with the same columns and semantics.
+            /// The switch compiles to a jump table into the lexDecU64<d>
+            /// instances, which is what DIGITS[d] does with computed goto.
+            inline u64t &
+                portable(
+                        u64r ull,
+                        s08pr s,
+                        u64t &e,                      // NOLINT
+                        const size_t &d = 20,
+                        u64t r = top,
+                        u64t b = zip
+                        ) {
+                    s08p o = s;
+
+                    if ((e |= (d > 20))) goto err;
+                    switch (d) {
+#define DECU64CASE(n) \
+        case n + 1: return lexDecU64<n + 1>::lex(ull, s, e, r, b)
+        DECU64CASE(19);
+        DECU64CASE(18);
+        DECU64CASE(17);
+        DECU64CASE(16);
+        DECU64CASE(15);
+        DECU64CASE(14);
+        DECU64CASE(13);
+        DECU64CASE(12);
+        DECU64CASE(11);
+        DECU64CASE(10);
+        DECU64CASE(9);
+        DECU64CASE(8);
+        DECU64CASE(7);
+        DECU64CASE(6);
+        DECU64CASE(5);
+        DECU64CASE(4);
+        DECU64CASE(3);
+        DECU64CASE(2);
+        DECU64CASE(1);
+        DECU64CASE(0);
+                        default: goto err;    ///< d == 0 as DIGITS[0]
+                    }
+err:                s = o;                ///< On failure, restore the pointer
+                    return ull = zip;
+                }
+
+            /// Self-delimiting form: the field is the run of digits at s,
+            /// so the caller need not measure it first.  The run is found
+            /// with two 16 byte compares; with SSE4.1 the same registers are
+            /// summed by sweep(), otherwise the columns are entered once for
+            /// exactly that many digits.  s ends past the number.
+            /// An empty run, or one longer than 20 digits, is an error.
+            inline u64t &
+                delimited(
+                        u64r ull,
+                        s08pr s,
+                        u64t &e,                      // NOLINT
+                        u64t r = top,
+                        u64t b = zip
+                        ) {
+#if LETTVIN_LEXDEC_SIMD
+                    if (!e && kernel &&
+                            (reinterpret_cast<uintptr_t>(s) & 4095) <= 4064)
+                        return sweep(ull, s, e, r, b);
+#endif
+                    const size_t d = span(s);
+                    e |= (d == 0);
+                    return (*this)(ull, s, e, d, r, b);
+                }
+
+            /// Batch form for fixed-width records: lex count fields of width
+            /// digits found at base + offset + i * stride into out[i].
+            /// Bit i of the caller's bits[(count + 63) / 64] is set when
+            /// field i is in error (out[i] is then 0), exactly where
+            /// operator() would set e; a width of 0 or over 20 fails all.
+            /// The width dispatch happens once, outside the record loop, so
+            /// no per-field dispatch or e test remains: each record is summed
+            /// without branches by the vector kernel's sums when the CPU has
+            /// them, else 8 digits to a register (SWAR).
+            /// Returns the number of fields in error.
+            size_t column(
+                    const char *base,
+                    size_t stride,
+                    size_t offset,
+                    size_t width,
+                    size_t count,
+                    u64p out,
+                    u64p bits,
+                    u64t r = top,
+                    u64t b = zip) {
+                const u08t *p = reinterpret_cast<const u08t *>(base) + offset;
+                switch (width) {
+#if LETTVIN_LEXDEC_SIMD
+#define DECU64ROWS(w) \
+        case w: return (w >= 8 && kernel) ? \
+            vrows<w>(p, stride, count, out, bits, r, b) : \
+            rows<w>(p, stride, count, out, bits, r, b)
 #else
-        DIGITS[20] = && c19;
-        DIGITS[19] = && c18;
-        DIGITS[18] = && c17;
-        DIGITS[17] = && c16;
-        DIGITS[16] = && c15;
-        DIGITS[15] = && c14;
-        DIGITS[14] = && c13;
-        DIGITS[13] = && c12;
-        DIGITS[12] = && c11;
-        DIGITS[11] = && c10;
-        DIGITS[10] = && c09;
-        DIGITS[9] = && c08;
-        DIGITS[8] = && c07;
-        DIGITS[7] = && c06;
-        DIGITS[6] = && c05;
-        DIGITS[5] = && c04;
-        DIGITS[4] = && c03;
-        DIGITS[3] = && c02;
-        DIGITS[2] = && c01;
-        DIGITS[1] = && c00;
-#endif
-
-        goto run;
+#define DECU64ROWS(w) \
+        case w: return rows<w>(p, stride, count, out, bits, r, b)
 #endif
+        DECU64ROWS(1);  DECU64ROWS(2);  DECU64ROWS(3);  DECU64ROWS(4);
+        DECU64ROWS(5);  DECU64ROWS(6);  DECU64ROWS(7);  DECU64ROWS(8);
+        DECU64ROWS(9);  DECU64ROWS(10); DECU64ROWS(11); DECU64ROWS(12);
+        DECU64ROWS(13); DECU64ROWS(14); DECU64ROWS(15); DECU64ROWS(16);
+        DECU64ROWS(17); DECU64ROWS(18); DECU64ROWS(19); DECU64ROWS(20);
                 }
+                for (size_t i = 0; i < count; ++i) out[i] = zip;
+                for (size_t i = 0; i < count; i += 64) {
+                    bits[i / 64] = count - i < 64 ?
+                        (one << (count - i)) - one : top;
+                }
+                return count;
+            }
 
 #ifdef LETTVIN_LEXERS_H_CPP_UNIT
             bool UnitTestShow(const char *t, const size_t digits) {
@@ -422,12 +1644,17 @@ fill:
             }
 
             void UnitTest(const u64t &val) {
-                std::stringstream ss;
-                ss << val; UnitTest(ss.str().c_str(), ss.str().size());
+                char buffer[32];
+                char *s = buffer;
+                const size_t d = fmtDecU64_Instance(s, val);
+                *s = 0;
+                UnitTest(buffer, d);
             }
 
-            void UnitTest() {
-                const char * test[] = {
+            /// Edge cases shown by UnitTest() and round-tripped by
+            /// UnitTestFormat(), ending with a null pointer.
+            static const char *const *UnitTestEdges() {
+                static const char *const test[] = {
                     "0",
                     "1",
                     "2",
@@ -457,6 +1684,11 @@ fill:
                     "",                       ///< bad, too  few digits
                     0L                        /// terminate with null ptr
                 };
+                return test;
+            }
+
+            void UnitTest() {
+                const char *const *test = UnitTestEdges();
 
                 std::cout <<
                     std::setw(21) <<  "IN" <<
@@ -477,169 +1709,4856 @@ fill:
                 val -= one; UnitTest(val);   ///< This wraps around.  No error.
                 val += one; UnitTest(val);
             }
-#endif
-
- private:
-            ///################################################################
-            static const u64t zip =  0ULL;
-            static const u64t one =  1ULL;
-            static const u64t ten = 10ULL;
-            static const u64t top = 0xFFFFFFFFFFFFFFFFULL;
 
-            static const u64t p0 =      one;
-            static const u64t p1 =      ten;
-            static const u64t p2 = p1 * ten;
-            static const u64t p3 = p2 * ten;
-            static const u64t p4 = p3 * ten;
-            static const u64t p5 = p4 * ten;
-            static const u64t p6 = p5 * ten;
-            static const u64t p7 = p6 * ten;
-            static const u64t p8 = p7 * ten;
-            static const u64t p9 = p8 * ten;
-            static const u64t pA = p9 * ten;
-            static const u64t pB = pA * ten;
-            static const u64t pC = pB * ten;
-            static const u64t pD = pC * ten;
-            static const u64t pE = pD * ten;
-            static const u64t pF = pE * ten;
-            static const u64t pG = pF * ten;
-            static const u64t pH = pG * ten;
-            static const u64t pI = pH * ten;
-            static const u64t pJ = pI * ten;
+            /// Round-trip fmtDecU64t through the lexer: every good edge
+            /// case of UnitTest(), each power of 10 and its neighbours, and
+            /// random values of every length, in minimal form (compared
+            /// with snprintf), in every fixed width (too narrow must set e
+            /// and write nothing) and through both batch forms.
+            void UnitTestFormat() {
+                std::vector<u64t> values;
+                for (const char *const *t = UnitTestEdges(); *t; ++t) {
+                    char *s = const_cast<char *>(*t);
+                    u64t v = 0, e = 0;
+                    (*this)(v, s, e, strlen(*t));
+                    if (!e) values.push_back(v);
+                }
+                for (size_t n = 0; n < 20; ++n) {
+                    values.push_back(decPower(n) - 1);
+                    values.push_back(decPower(n));
+                    values.push_back(decPower(n) + 1);
+                }
+                values.push_back(u64t(top));
+                u64t x = 20160529ULL;   ///< LCG state
+                for (size_t i = 0; i < 2000; ++i) {
+                    x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+                    values.push_back(x >> (x >> 58));
+                }
+                size_t cases = 0, mismatches = 0;
+                for (size_t i = 0; i < values.size(); ++i) {
+                    const u64t v = values[i];
+                    char buffer[32], expect[32];
+                    char *s = buffer;
+                    const size_t d = fmtDecU64_Instance(s, v);
+                    snprintf(expect, sizeof(expect), "%llu",
+                            static_cast<unsigned long long>(v));
+                    mismatches += d != strlen(expect) || s != buffer + d ||
+                        memcmp(buffer, expect, d);
+                    ++cases;
+                    for (size_t w = 0; w <= 21; ++w, ++cases) {
+                        memset(buffer, '#', sizeof(buffer));
+                        u64t e = 0, got = 0;
+                        s = buffer;
+                        const size_t n = fmtDecU64_Instance(s, v, e, w);
+                        if (w == 0 || w > 20 || w < d) {
+                            mismatches += !e || n || s != buffer ||
+                                buffer[0] != '#';
+                            continue;
+                        }
+                        char *t = buffer;
+                        (*this)(got, t, e, w);
+                        mismatches += e || n != w || got != v ||
+                            s != buffer + w || t != s || *s != '#';
+                    }
+                }
+                std::vector<char> text(21 * values.size());
+                char *s = text.data();
+                const size_t bytes = fmtDecU64_Instance.delimited(s,
+                        values.data(), values.size(), ',');
+                s = text.data();
+                for (size_t i = 0; i < values.size(); ++i, ++s, ++cases) {
+                    u64t v = 0, e = 0;
+                    delimited(v, s, e);
+                    mismatches += e || v != values[i] || *s != ',';
+                }
+                mismatches += s != text.data() + bytes;
+                for (size_t w = 1; w <= 20; ++w) {
+                    const size_t stride = w + 3, count = values.size();
+                    std::vector<char> rows(stride * count, '#');
+                    std::vector<u64t> bits((count + 63) / 64), back(count);
+                    std::vector<u64t> bits2((count + 63) / 64);
+                    /// Fields too wide stay '#', which the lexer reads as 0.
+                    const size_t bad = fmtDecU64_Instance.column(
+                            rows.data(), stride, 1, w, count,
+                            values.data(), bits.data());
+                    column(rows.data(), stride, 1, w, count, back.data(),
+                            bits2.data());
+                    size_t wide = 0;
+                    for (size_t i = 0; i < count; ++i, ++cases) {
+                        const bool no = fmtDecU64t::digits(values[i]) > w;
+                        wide += no;
+                        mismatches += no != ((bits[i / 64] >> i % 64) & 1) ||
+                            (!no && ((bits2[i / 64] >> i % 64) & 1)) ||
+                            (!no && back[i] != values[i]) ||
+                            rows[i * stride] != '#' ||
+                            rows[i * stride + w + 1] != '#';
+                    }
+                    mismatches += bad != wide;
+                }
+                std::cout << "format: " << cases << " cases " <<
+                    mismatches << " mismatches" << std::endl;
+            }
 
-            static const bool inv[ 20 ][ 256 ];  ///< Invalid character table
-            static const u64t col[ 20 ][ 256 ];  ///< column-value lookup table
-};
+            /// Lex a fixed set of fields, one of each outcome, on two
+            /// threads and check the lexStats::snapshot() difference: each
+            /// count times two with -DLETTVIN_LEXDEC_STATS=1, all 0 without.
+            void UnitTestStats() {
+                struct Case {
+                    const char *text;
+                    size_t d;
+                    u64t hi, lo;
+                    size_t kind;   ///< 0 good, then as lexStats, 5 width
+                };
+                static const Case cases[] = {
+                    {"1234", 4, top, zip, 0},
+                    {"18446744073709551615", 20, top, zip, 0},
+                    {"", 0, top, zip, 0},
+                    {"28446744073709551615", 20, top, zip, 1},
+                    {"18446744073709551616", 20, top, zip, 2},
+                    {"99999999999999999999", 20, top, zip, 1},
+                    {"12345678", 8, 12345677, zip, 3},
+                    {"12345678", 8, top, 12345679, 4},
+                    {"000000000000000000001", 21, top, zip, 5},
+                };
+                const size_t count = sizeof(cases) / sizeof(cases[0]);
+                const size_t threads = 2;
+                const lexStats before = lexStats::snapshot();
+                std::vector<std::thread> pool;
+                for (size_t t = 0; t < threads; ++t) {
+                    pool.push_back(std::thread([this, count]() {
+                        for (size_t i = 0; i < count; ++i) {
+                            char *s = const_cast<char *>(cases[i].text);
+                            u64t v = 0, e = 0;
+                            (*this)(v, s, e, cases[i].d,
+                                    cases[i].hi, cases[i].lo);
+                            s = const_cast<char *>(cases[i].text);
+                            (*this)(v, s, e = 1, cases[i].d);  ///< no-op
+                        }
+                    }));
+                }
+                for (size_t t = 0; t < threads; ++t) pool[t].join();
+                const lexStats after = lexStats::snapshot();
+                lexStats want;
+#if LETTVIN_LEXDEC_STATS
+                for (size_t i = 0; i < count; ++i) {
+                    want.d[cases[i].d < 21 ? cases[i].d : 21] += threads;
+                    u64t *kind[] = {0, &want.invalid, &want.overflow,
+                        &want.above, &want.below, &want.width};
+                    if (cases[i].kind) *kind[cases[i].kind] += threads;
+                }
+#endif
+                size_t mismatches = 0;
+                for (size_t i = 0; i < 22; ++i) {
+                    mismatches += after.d[i] - before.d[i] != want.d[i];
+                }
+                mismatches += after.invalid - before.invalid != want.invalid;
+                mismatches += after.overflow - before.overflow !=
+                    want.overflow;
+                mismatches += after.above - before.above != want.above;
+                mismatches += after.below - before.below != want.below;
+                mismatches += after.width - before.width != want.width;
+                std::cout << "stats: " << threads << " threads " <<
+                    threads * count << " calls " << mismatches <<
+                    " mismatches" << std::endl;
+            }
 
-    /// PPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPPP
-    /// These defines are used to fill the col table with BAD values
-#define B00000010(x) x, x
-#define B00000100(x) B00000010(x), B00000010(x)
-#define B00001000(x) B00000100(x), B00000100(x)
-#define B00010000(x) B00001000(x), B00001000(x)
-#define B00100000(x) B00010000(x), B00010000(x)
-#define B01000000(x) B00100000(x), B00100000(x)
-#define B10000000(x) B01000000(x), B01000000(x)
-#define B00110000(x)  \
-    B00100000(x), \
-    B00010000(x)
-#define B11000110(x)  \
-    B10000000(x), \
-    B01000000(x), \
-    B00000100(x), \
-    B00000010(x)
-#define Bad48   B00110000(zip)
-#define Bad198  B11000110(zip)
-#define True48  B00110000(false)
-#define True198 B11000110(false)
+            typedef u64t &(*fixed_t)(u64r, s08pr, u64t &, u64t, u64t);
 
-    ///########################################################################
-    /// Table of digit validity for each column
-    const bool lexDecU64t::inv[ 20 ][ 256 ] = {
-#if Alternate
-#define DECU64INVTABLE(a) \
-        { True48, false, false, B00001000(a), True198}
-        DECU64INVTABLE(false),
-        DECU64INVTABLE(false),
-        DECU64INVTABLE(false),
-        DECU64INVTABLE(false),
-        DECU64INVTABLE(false),
-        DECU64INVTABLE(false),
-        DECU64INVTABLE(false),
-        DECU64INVTABLE(false),
-        DECU64INVTABLE(false),
-        DECU64INVTABLE(false),
-        DECU64INVTABLE(false),
-        DECU64INVTABLE(false),
-        DECU64INVTABLE(false),
-        DECU64INVTABLE(false),
-        DECU64INVTABLE(false),
-        DECU64INVTABLE(false),
-        DECU64INVTABLE(false),
-        DECU64INVTABLE(false),
-        DECU64INVTABLE(false),
-        DECU64INVTABLE(true)    ///< highest column has limited digits
+            /// Compare each lexDecU64<W>, W = 1..20, with a checked loop and
+            /// with the runtime-d entry: random fields of every width, the
+            /// edge cases of that width, one non-digit at each position,
+            /// hi and lo on both sides of the value, and e set on entry.
+            void UnitTestWidths() {
+                const fixed_t *width = UnitTestWidths(buildIndices<20>::type());
+                size_t cases = 0, mismatches = 0;
+                u64t x = 20160529ULL;   ///< LCG state
+                for (size_t d = 1; d <= 20; ++d) {
+                    std::vector<std::string> fields;
+                    for (const char *const *t = UnitTestEdges(); *t; ++t)
+                        if (strlen(*t) == d) fields.push_back(*t);
+                    for (size_t i = 0; i < 100; ++i) {
+                        std::string f(d, '0');
+                        for (size_t k = 0; k < d; ++k) {
+                            x = x * 6364136223846793005ULL +
+                                1442695040888963407ULL;
+                            f[k] = static_cast<s08t>('0' + (x >> 60) % 10);
+                        }
+                        if (i < d) f[i] = static_cast<s08t>(x >> 56);
+                        fields.push_back(f);
+                    }
+                    for (size_t i = 0; i < fields.size(); ++i) {
+                        char buffer[32];
+                        memcpy(buffer, fields[i].data(), d);
+                        buffer[d] = '7';   ///< never lexed
+                        u64t want = 0, bad = 0;
+                        for (size_t k = 0; k < d && !bad; ++k) {
+                            const u64t c = static_cast<u08t>(buffer[k]) - '0';
+                            const u64t g = c < 10 ? c : 0;
+                            bad = want > (top - g) / 10;
+                            want = want * 10 + g;
+                        }
+                        const u64t bounds[][2] = {{top, zip},
+                            {want, want}, {want - 1, zip}, {top, want + 1}};
+                        for (size_t j = 0; j < 4; ++j) {
+                            const u64t hi = bounds[j][0], lo = bounds[j][1];
+                            for (u64t preset = 0; preset < 2; ++preset) {
+                                char *s = buffer, *t = buffer;
+                                u64t v = 7, w = 7, e = preset, f = preset;
+                                width[d - 1](v, s, e, hi, lo);
+                                (*this)(w, t, f, d, hi, lo);
+                                const bool fail = preset || bad ||
+                                    want > hi || want < lo;
+                                mismatches += v != (fail ? 0 : want) ||
+                                    s != buffer + (fail ? 0 : d) ||
+                                    !e != !fail || v != w || s != t ||
+                                    e != f;
+                                ++cases;
+                            }
+                        }
+                    }
+                }
+                std::cout << "widths: " << cases << " cases " <<
+                    mismatches << " mismatches" << std::endl;
+            }
+            template <size_t... I>
+            static const fixed_t *UnitTestWidths(indices<I...>) {
+                static const fixed_t width[] = { &lexDecU64<I + 1>::lex... };
+                return width;
+            }
+
+            /// Compare the decCompact lookups with decTable for every byte
+            /// in every column, whichever layout the engines were built on.
+            void UnitTestCompact() {
+                size_t cases = 0, mismatches = 0;
+                for (size_t n = 0; n < 20; ++n) {
+                    for (size_t c = 0; c < 256; ++c, ++cases) {
+                        const u08t k = decCompact<>::cls[c];
+                        mismatches += decCompact<>::val[n][k] != col[n][c];
+                        mismatches += (n == 19 && k > 1) != inv[n][c];
+                    }
+                }
+                std::cout << "compact tables: " << cases << " cases " <<
+                    mismatches << " mismatches" << std::endl;
+            }
+
+            /// Compare portable() and every vector kernel with the jump table
+            /// (or with portable() itself when that is the engine) over each
+            /// width: random digits, top-column edges, one bad character at
+            /// each position, and hi/lo on both sides of the value.
+            /// Bytes after the field are digits so overreads would show.
+            void UnitTestKernel() {
+                char buffer[64];
+                size_t cases = 0, mismatches = 0, slips = 0;
+                u64t x = 20080505ULL;   ///< LCG state
+#if LETTVIN_LEXDEC_SIMD
+                kernel_t saved = kernel;
+#endif
+                for (size_t d = 1; d <= 20; ++d) {
+                    for (size_t k = 0; k < 400; ++k) {
+                        memset(buffer, '7', sizeof(buffer));
+                        for (size_t i = 0; i < d; ++i) {
+                            x = x * 6364136223846793005ULL +
+                                1442695040888963407ULL;
+                            buffer[i] = static_cast<char>('0' + (x >> 33) % 10);
+                        }
+                        if (k % 4 == 1 && d == 20) {
+                            memcpy(buffer, "18446744073709551615", 20);
+                            buffer[19 - (x >> 40) % 3] += (x >> 50) % 3;
+                        }
+                        if (k % 4 == 2) {
+                            buffer[(x >> 45) % d] = "/:a \0-+."[(x >> 20) % 8];
+                        }
+                        u64t ref = zip, err = zip;
+                        char *t = buffer;
+#if LETTVIN_LEXDEC_SIMD
+                        kernel = 0;
+#endif
+                        (*this)(ref, t, err, d);
+                        u64t hi = top, lo = zip;
+                        switch (k % 8) {
+                            case 3: hi = ref; break;
+                            case 5: hi = ref - one; break;
+                            case 7: lo = ref + one; break;
+                            case 0: lo = ref; break;
+                        }
+                        u64t want = zip, werr = zip;
+                        char *w = buffer;
+                        (*this)(want, w, werr, d, hi, lo);
+                        u64t got = zip, gerr = zip;
+                        char *g = buffer;
+                        portable(got, g, gerr, d, hi, lo);
+                        slips += got != want || gerr != werr || g != w;
+#if LETTVIN_LEXDEC_SIMD
+                        kernel = saved;
+                        kernel_t each[3] = { 0, 0, 0 };
+                        if (__builtin_cpu_supports("sse4.1")) each[1] = sse41;
+                        if (__builtin_cpu_supports("avx2")) each[2] = avx2;
+#else
+                        int each[1] = { 0 };
+#endif
+                        bool same = true;
+                        const size_t n = sizeof(each) / sizeof(*each);
+                        for (size_t j = 0; j < n; ++j) {
+                            got = 7ULL, gerr = zip, g = buffer;
+                            if (j == 0) {
+                                (*this)(got, g, gerr, d, hi, lo);
+#if LETTVIN_LEXDEC_SIMD
+                            } else if (each[j]) {
+                                each[j](got, g, gerr, d, hi, lo);
+#endif
+                            } else {
+                                continue;
+                            }
+                            same &= got == want && gerr == werr && g == w;
+                        }
+                        mismatches += !same;
+                        ++cases;
+                    }
+                }
+                std::cout <<
+                    "portable engine: " << cases << " cases " <<
+                    slips << " mismatches" << std::endl;
+                std::cout <<
+                    "vector kernel: " << cases << " cases " <<
+                    mismatches << " mismatches" << std::endl;
+            }
+
+            /// Lex the same random fields from 4 threads released together
+            /// and compare each with a serial portable() pass.  Built with
+            /// -fsanitize=thread ("make race") this is the race check.
+            void UnitTestThreads() {
+                const size_t threads = 4, count = 20000;
+                std::vector<std::string> text(count);
+                std::vector<u64t> want(count), werr(count);
+                u64t x = 20160523ULL;   ///< LCG state
+                for (size_t i = 0; i < count; ++i) {
+                    x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+                    const size_t d = 1 + (x >> 33) % 21;
+                    for (size_t j = 0; j < d; ++j) {
+                        x = x * 6364136223846793005ULL +
+                            1442695040888963407ULL;
+                        text[i] += static_cast<char>('0' + (x >> 33) % 10);
+                    }
+                }
+                for (size_t i = 0; i < count; ++i) {
+                    std::string copy = text[i];
+                    char *s = &copy[0];
+                    portable(want[i], s, werr[i], copy.size());
+                }
+                std::vector<size_t> mismatches(threads);
+                std::vector<std::thread> pool;
+                std::mutex gate;
+                gate.lock();
+                for (size_t t = 0; t < threads; ++t) {
+                    pool.push_back(std::thread([&, t]() {
+                        gate.lock();
+                        gate.unlock();
+                        for (size_t i = 0; i < count; ++i) {
+                            char *s = const_cast<char *>(text[i].c_str());
+                            u64t v = 7, e = 0;
+                            (*this)(v, s, e, text[i].size());
+                            mismatches[t] += v != want[i] || e != werr[i];
+                        }
+                    }));
+                }
+                gate.unlock();
+                size_t total = 0;
+                for (size_t t = 0; t < threads; ++t) {
+                    pool[t].join();
+                    total += mismatches[t];
+                }
+                std::cout << "threads: " << threads << " x " << count <<
+                    " cases " << total << " mismatches" << std::endl;
+            }
+
+            /// Show delimited() on edge cases, then compare it with the
+            /// measure-then-lex pattern on random runs placed on both sides
+            /// of a page boundary so every load path is taken.
+            void UnitTestDelimited() {
+                const char * test[] = {
+                    "0,",
+                    "123 456",
+                    "18446744073709551615|",
+                    "18446744073709551616|",  ///< bad, too high value
+                    "00000000000000000001;",  ///< good, 20 digits
+                    "000000000000000000001;", ///< bad, too many digits
+                    ",1",                     ///< bad, no digits
+                    "",                       ///< bad, no digits
+                    "42",
+                    0L                        /// terminate with null ptr
+                };
+                std::cout <<
+                    std::setw(24) << "DELIMITED" <<
+                    std::setw(21) << "OUT" <<
+                    "  N E" << std::endl;
+                for (size_t i = 0; test[i]; ++i) {
+                    char buffer[32];
+                    strcpy(buffer, test[i]);  // NOLINT
+                    char *t = buffer;
+                    u64t ull = zip, error = zip;
+                    delimited(ull, t, error);
+                    std::cout <<
+                        std::setw(24) << test[i] <<
+                        std::setw(21) << ull << " " <<
+                        std::setw(2) << (t - buffer) << " " <<
+                        error << std::endl;
+                }
+
+                static char page[3 * 4096];
+                char *base = page + 4096 -
+                    (reinterpret_cast<uintptr_t>(page) & 4095);
+                size_t cases = 0, mismatches = 0;
+                u64t x = 20160518ULL;   ///< LCG state
+#if LETTVIN_LEXDEC_SIMD
+                kernel_t saved = kernel;
+#endif
+                for (size_t pass = 0; pass < 2; ++pass) {
+                    for (size_t d = 0; d <= 24; ++d) {
+#if LETTVIN_LEXDEC_SIMD
+                        kernel = pass ? 0 : saved;  ///< sweep() then span()
+#endif
+                        for (size_t at = 4096 - 40; at <= 4096 + 8; ++at) {
+                            char *f = base + at;
+                            for (size_t i = 0; i < d; ++i) {
+                                x = x * 6364136223846793005ULL +
+                                    1442695040888963407ULL;
+                                f[i] = static_cast<char>('0' + (x >> 33) % 10);
+                            }
+                            f[d] = ",; \n|\0"[(x >> 40) % 6];
+                            u64t want = zip, werr = zip;
+                            char *w = f;
+                            size_t n = 0;
+                            while (f[n] >= '0' && f[n] <= '9') ++n;
+                            werr |= (n == 0);
+                            (*this)(want, w, werr, n);
+                            u64t got = 7ULL, gerr = zip;
+                            char *g = f;
+                            delimited(got, g, gerr);
+                            mismatches += got != want || gerr != werr || g != w;
+                            ++cases;
+                        }
+                    }
+                }
+#if LETTVIN_LEXDEC_SIMD
+                kernel = saved;
+#endif
+                std::cout <<
+                    "delimited: " << cases << " cases " <<
+                    mismatches << " mismatches" << std::endl;
+            }
+
+            /// Show column() on a small fixed-width file, then compare it
+            /// with operator() on random records of every width.
+            void UnitTestColumn() {
+                const char records[] =
+                    "A|0000000042|18446744073709551615|\n"
+                    "B|0000000007|18446744073709551616|\n"
+                    "C|00000x0100|00000000000000000000|\n"
+                    "D|9999999999|29999999999999999999|\n";
+                const size_t stride = 35;
+                u64t out[4], bits[1];
+                size_t errors;
+                errors = column(records, stride, 2, 10, 4, out, bits);
+                std::cout << "column 10:";
+                for (size_t i = 0; i < 4; ++i) std::cout << " " << out[i];
+                std::cout << " bits " << bits[0] << " errors " << errors <<
+                    std::endl;
+                errors = column(records, stride, 13, 20, 4, out, bits);
+                std::cout << "column 20:";
+                for (size_t i = 0; i < 4; ++i) std::cout << " " << out[i];
+                std::cout << " bits " << bits[0] << " errors " << errors <<
+                    std::endl;
+                errors = column(records, stride, 2, 10, 4, out, bits, 100, 7);
+                std::cout << "column 10 [7,100]:";
+                for (size_t i = 0; i < 4; ++i) std::cout << " " << out[i];
+                std::cout << " bits " << bits[0] << " errors " << errors <<
+                    std::endl;
+
+                static char file[150 * 24];
+                static u64t vals[150], mask[3];
+                size_t cases = 0, mismatches = 0;
+                u64t x = 20160517ULL;   ///< LCG state
+#if LETTVIN_LEXDEC_SIMD
+                kernel_t saved = kernel;
+#endif
+                for (size_t pass = 0; pass < 2; ++pass) {
+#if LETTVIN_LEXDEC_SIMD
+                    kernel = pass ? 0 : saved;  ///< vrows() then rows()
+#endif
+                    for (size_t w = 1; w <= 20; ++w) {
+                        for (size_t i = 0; i < sizeof(file); ++i) {
+                            x = x * 6364136223846793005ULL +
+                                1442695040888963407ULL;
+                            file[i] = (x >> 59) ? '0' + (x >> 33) % 10 : '.';
+                            if (w == 20 && i % 24 == 1 && (x >> 20) % 2)
+                                file[i] = '1';
+                        }
+                        const u64t hi = w % 3 ? top : top / 3;
+                        const u64t lo = w % 4 ? zip : pC;
+                        size_t count = 150;
+                        errors = column(file, 24, 1, w, count,
+                                        vals, mask, hi, lo);
+                        size_t wrong = 0;
+                        for (size_t i = 0; i < count; ++i) {
+                            u64t want = zip, werr = zip;
+                            char *t = file + i * 24 + 1;
+                            (*this)(want, t, werr, w, hi, lo);
+                            wrong += vals[i] != want ||
+                                ((mask[i / 64] >> (i % 64)) & one) != werr;
+                            errors -= werr;
+                            ++cases;
+                        }
+                        mismatches += wrong + (errors != 0);
+                    }
+                }
+#if LETTVIN_LEXDEC_SIMD
+                kernel = saved;
+#endif
+                std::cout <<
+                    "column: " << cases << " cases " <<
+                    mismatches << " mismatches" << std::endl;
+            }
+#endif
+
+ private:
+            /// decKernel<> is set by cpuid(); lexRadU64t and lexFixS64t
+            /// share paged() and span().
+            template <typename> friend struct decKernel;
+            template <u64t> friend class lexRadU64t;
+            friend class lexFixS64t;
+
+#if LETTVIN_LEXDEC_STATS
+            /// Counts one call of operator() as it returns: its d and, if
+            /// the call set e, why.  Only a failed call looks at its field
+            /// again, through portable(), to tell overflow from hi and lo.
+            class note {
+             public:
+                note(lexDecU64t &lexer, const char *s, const u64t &e,  // NOLINT
+                        size_t d, u64t hi, u64t lo)
+                    : lexer_(lexer), s_(s), e_(e), was_(e), d_(d),
+                      hi_(hi), lo_(lo) {}
+
+                ~note() {
+                    if (was_) return;             ///< nothing was lexed
+                    lexStatsCell &c = lexStatsCell::local();
+                    c.add(c.d[d_ < 21 ? d_ : 21]);
+                    if (!e_) return;
+                    if (d_ > 20) {
+                        c.add(c.width);
+                    } else if (d_ == 20 && static_cast<u08t>(*s_ - '2') < 8) {
+                        c.add(c.invalid);
+                    } else {
+                        u64t v = zip, e = zip;
+                        char *t = const_cast<char *>(s_);
+                        lexer_.portable(v, t, e, d_);
+                        c.add(e ? c.overflow : v > hi_ ? c.above : c.below);
+                    }
+                }
+
+             private:
+                lexDecU64t &lexer_;
+                const char *s_;
+                const u64t &e_;
+                const bool was_;
+                const size_t d_;
+                const u64t hi_, lo_;
+            };
+#endif
+
+            ///################################################################
+            static const u64t zip =  0ULL;
+            static const u64t one =  1ULL;
+            static const u64t ten = 10ULL;
+            static const u64t top = 0xFFFFFFFFFFFFFFFFULL;
+
+            static const u64t p0 =      one;
+            static const u64t p1 =      ten;
+            static const u64t p2 = p1 * ten;
+            static const u64t p3 = p2 * ten;
+            static const u64t p4 = p3 * ten;
+            static const u64t p5 = p4 * ten;
+            static const u64t p6 = p5 * ten;
+            static const u64t p7 = p6 * ten;
+            static const u64t p8 = p7 * ten;
+            static const u64t p9 = p8 * ten;
+            static const u64t pA = p9 * ten;
+            static const u64t pB = pA * ten;
+            static const u64t pC = pB * ten;
+            static const u64t pD = pC * ten;
+            static const u64t pE = pD * ten;
+            static const u64t pF = pE * ten;
+            static const u64t pG = pF * ten;
+            static const u64t pH = pG * ten;
+            static const u64t pI = pH * ten;
+            static const u64t pJ = pI * ten;
+
+            /// inv[ 20 ][ 256 ]: Invalid character table, from decTable
+            /// col[ 20 ][ 256 ]: column-value lookup table, from decTable
+
+            /// Count the ASCII digits at s, stopping once past 20.
+            LETTVIN_UNSANITIZED
+            static inline size_t span(const char *s) {
+#if LETTVIN_LEXDEC_SIMD
+                if ((reinterpret_cast<uintptr_t>(s) & 4095) <= 4096 - 32) {
+                    const __m128i nine = _mm_set1_epi8(9);
+                    const __m128i zero = _mm_set1_epi8('0');
+                    __m128i x = _mm_sub_epi8(_mm_loadu_si128(
+                            reinterpret_cast<const __m128i *>(s)), zero);
+                    __m128i y = _mm_sub_epi8(_mm_loadu_si128(
+                            reinterpret_cast<const __m128i *>(s + 16)), zero);
+                    u32t m = static_cast<u32t>(_mm_movemask_epi8(
+                            _mm_cmpeq_epi8(_mm_max_epu8(x, nine), nine)));
+                    m |= static_cast<u32t>(_mm_movemask_epi8(
+                            _mm_cmpeq_epi8(_mm_max_epu8(y, nine), nine))) << 16;
+                    return ~m ? __builtin_ctz(~m) : 32;
+                }
+#endif
+                size_t n = 0;
+                while (n <= 20 && static_cast<u08t>(s[n] - '0') < 10) ++n;
+                return n;
+            }
+
+            /// Records for one width W, 64 to each word of bits.
+            template <size_t W>
+            static size_t rows(
+                    const u08t *p, size_t stride, size_t count,
+                    u64p out, u64p bits, u64t r, u64t b) {
+                size_t errors = 0;
+                for (size_t i = 0; i < count; i += 64) {
+                    const size_t n = count - i < 64 ? count - i : 64;
+                    u64t word = zip, v;
+                    for (size_t j = 0; j < n; ++j) {
+                        const bool no = swar<W>(p + (i + j) * stride, r, b, v);
+                        out[i + j] = v;
+                        word |= u64t(no) << j;
+                        errors += no;
+                    }
+                    bits[i / 64] = word;
+                }
+                return errors;
+            }
+
+            /// One field of width W.  Leading W % 8 columns are summed by
+            /// x10 and the rest by eight() in 8 column chunks, a non-digit
+            /// counting as 0 as in col[][].  Only W == 20 can overflow; the
+            /// test before its last chunk also covers the top column limit.
+            /// Returns true on error, with v then 0.
+            template <size_t W>
+            static inline bool swar(const u08t *f, u64t r, u64t b, u64r v) {
+                u64t c;
+                bool no = false;
+                v = zip;
+                for (size_t k = 0; k < W % 8; ++k) {
+                    c = static_cast<u08t>(f[k] - '0');
+                    v = v * ten + (c < ten ? c : zip);
+                }
+                for (size_t k = W % 8; k < W; k += 8) {
+                    c = eight(f + k);
+                    if (W == 20) no |= v > (top - c) / p8;
+                    v = v * p8 + c;
+                }
+                no |= v > r;
+                no |= v < b;
+                if (no) v = zip;
+                return no;
+            }
+
+#if LETTVIN_LEXDEC_SIMD
+            /// rows() with the vector kernel's sums for W of 8 or more;
+            /// a short field whose load could cross a page uses swar().
+            template <size_t W>
+            __attribute__((target("sse4.1"), no_sanitize_address))
+            static size_t vrows(
+                    const u08t *p, size_t stride, size_t count,
+                    u64p out, u64p bits, u64t r, u64t b) {
+                size_t errors = 0;
+                for (size_t i = 0; i < count; i += 64) {
+                    const size_t n = count - i < 64 ? count - i : 64;
+                    u64t word = zip, v, h;
+                    for (size_t j = 0; j < n; ++j) {
+                        const char *f = reinterpret_cast<const char *>(
+                                p + (i + j) * stride);
+                        bool no;
+                        if (W < 16 && !paged(f)) {
+                            no = swar<W>(p + (i + j) * stride, r, b, v);
+                        } else {
+                            if (W <= 16) {
+                                h = zip;
+                                v = sum16(_mm_shuffle_epi8(
+                                        digits(f), align(W)));
+                            } else {
+                                h = sum16(_mm_shuffle_epi8(
+                                        digits(f), align(W - 16)));
+                                v = sum16(digits(f + W - 16));
+                            }
+                            no = h > (top - v) / pG;
+                            v += h * pG;
+                            no |= v > r;
+                            no |= v < b;
+                            if (no) v = zip;
+                        }
+                        out[i + j] = v;
+                        word |= u64t(no) << j;
+                        errors += no;
+                    }
+                    bits[i / 64] = word;
+                }
+                return errors;
+            }
+#endif
+
+            /// SWAR sum of 8 columns: bytes are taken little-endian (one
+            /// load where the target is), non-digits masked to 0, then pairs,
+            /// quads and the two halves are combined with three multiplies.
+            static inline u64t eight(const u08t *f) {
+                u64t x = zip;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+                memcpy(&x, f, sizeof(x));
+#else
+                for (size_t k = 0; k < 8; ++k) x |= u64t(f[k]) << (8 * k);
+#endif
+                const u64t low = 0x0F0F0F0F0F0F0F0FULL;
+                u64t d = x & low;
+                u64t no = ((((x >> 4) & low) ^ 0x0303030303030303ULL) + low) |
+                          (d + 0x0606060606060606ULL);
+                d &= ~(((no >> 4) & 0x0101010101010101ULL) * 0xFF);
+                d = d * 10 + (d >> 8);
+                const u64t odd = 0x000000FF000000FFULL;
+                return (((d & odd) * (100 + (1000000ULL << 32))) +
+                        (((d >> 16) & odd) * (1 + (10000ULL << 32)))) >> 32;
+            }
+
+#if LETTVIN_LEXDEC_SIMD
+            ///################################################################
+            /// Vector kernels take the same arguments as operator() and give
+            /// bit-identical results: value, error flag and pointer restore.
+            /// As in col[][], a non-digit byte counts as a zero digit, so
+            /// 16 bytes are masked at a time with one unsigned max compare;
+            /// the top column limit of inv[][] falls out of the overflow test.
+            /// Columns are summed pairwise: x10, x100, x10000, then x10^8.
+            /// Fields over 16 digits split into a head and a 16 digit tail;
+            /// both loads then lie inside the field so no page test is needed.
+            /// kernel_t and kernel, the CPUID choice, are decKernel<>'s.
+
+            /// Choose the widest kernel this CPU supports.
+            static kernel_t cpuid() {
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("avx2")) return avx2;
+                if (__builtin_cpu_supports("sse4.1")) return sse41;
+                return 0;
+            }
+
+            /// A 16 byte load at s stays inside the page holding s.
+            static inline bool paged(const char *s) {
+                return (reinterpret_cast<uintptr_t>(s) & 4095) <= 4096 - 16;
+            }
+
+            __attribute__((target("sse4.1"), no_sanitize_address))
+            static u64t &sse41(
+                    u64r ull, s08pr s, u64t &e,                     // NOLINT
+                    size_t d, u64t r = top, u64t b = zip) {
+                if (d <= 16) {
+                    u64t v = sum16(_mm_shuffle_epi8(digits(s), align(d)));
+                    return finish(ull, s, e, d, r, b, zip, v);
+                }
+                u64t h = sum16(_mm_shuffle_epi8(digits(s), align(d - 16)));
+                u64t v = sum16(digits(s + d - 16));
+                return finish(ull, s, e, d, r, b, h, v);
+            }
+
+            __attribute__((target("avx2"), no_sanitize_address))
+            static u64t &avx2(
+                    u64r ull, s08pr s, u64t &e,                     // NOLINT
+                    size_t d, u64t r = top, u64t b = zip) {
+                if (d <= 16) {
+                    u64t v = sum16(_mm_shuffle_epi8(digits(s), align(d)));
+                    return finish(ull, s, e, d, r, b, zip, v);
+                }
+                /// Tail in the low lane, head in the high lane: one pass.
+                const __m256i nine = _mm256_set1_epi8(9);
+                __m256i x = _mm256_sub_epi8(_mm256_inserti128_si256(
+                        _mm256_castsi128_si256(_mm_loadu_si128(
+                            reinterpret_cast<const __m128i *>(s + d - 16))),
+                        _mm_loadu_si128(reinterpret_cast<const __m128i *>(s)),
+                        1), _mm256_set1_epi8('0'));
+                x = _mm256_and_si256(x,
+                        _mm256_cmpeq_epi8(_mm256_max_epu8(x, nine), nine));
+                __m128i iota = _mm_setr_epi8(
+                        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+                x = _mm256_shuffle_epi8(x, _mm256_inserti128_si256(
+                        _mm256_castsi128_si256(iota), align(d - 16), 1));
+                __m256i m = _mm256_maddubs_epi16(x, _mm256_set1_epi16(0x010A));
+                m = _mm256_madd_epi16(m, _mm256_set1_epi32(0x00010064));
+                m = _mm256_packus_epi32(m, m);
+                m = _mm256_madd_epi16(m, _mm256_set1_epi32(0x00012710));
+                __m128i lo = _mm256_castsi256_si128(m);
+                __m128i hi = _mm256_extracti128_si256(m, 1);
+                u64t v = u64t(u32t(_mm_cvtsi128_si32(lo))) * p8 +
+                         u32t(_mm_extract_epi32(lo, 1));
+                u64t h = u32t(_mm_extract_epi32(hi, 1));
+                return finish(ull, s, e, d, r, b, h, v);
+            }
+
+            /// Scan and sum in one pass: the 32 bytes at s hold the run and
+            /// fields up to 16 digits are summed from the register just
+            /// compared, with no dispatch on the digit count.
+            __attribute__((target("sse4.1"), no_sanitize_address))
+            static u64t &sweep(
+                    u64r ull, s08pr s, u64t &e,                     // NOLINT
+                    u64t r, u64t b) {
+                const __m128i nine = _mm_set1_epi8(9);
+                __m128i x = _mm_sub_epi8(_mm_loadu_si128(
+                        reinterpret_cast<const __m128i *>(s)),
+                        _mm_set1_epi8('0'));
+                __m128i y = _mm_sub_epi8(_mm_loadu_si128(
+                        reinterpret_cast<const __m128i *>(s + 16)),
+                        _mm_set1_epi8('0'));
+                u32t m = static_cast<u32t>(_mm_movemask_epi8(
+                        _mm_cmpeq_epi8(_mm_max_epu8(x, nine), nine)));
+                m |= static_cast<u32t>(_mm_movemask_epi8(
+                        _mm_cmpeq_epi8(_mm_max_epu8(y, nine), nine))) << 16;
+                const size_t d = ~m ? __builtin_ctz(~m) : 32;
+                if (d - 1 >= 20) {
+                    e |= one;
+                    return ull = zip;
+                }
+                if (d <= 16) {
+                    u64t v = sum16(_mm_shuffle_epi8(x, align(d)));
+                    return finish(ull, s, e, d, r, b, zip, v);
+                }
+                u64t h = sum16(_mm_shuffle_epi8(x, align(d - 16)));
+                u64t v = sum16(digits(s + d - 16));
+                return finish(ull, s, e, d, r, b, h, v);
+            }
+
+            /// Load 16 bytes as digit values; non-digit bytes become 0.
+            __attribute__((target("sse4.1"), no_sanitize_address))
+            static inline __m128i digits(const char *s) {
+                const __m128i nine = _mm_set1_epi8(9);
+                __m128i x = _mm_sub_epi8(
+                        _mm_loadu_si128(reinterpret_cast<const __m128i *>(s)),
+                        _mm_set1_epi8('0'));
+                return _mm_and_si128(x,
+                        _mm_cmpeq_epi8(_mm_max_epu8(x, nine), nine));
+            }
+
+            /// Shuffle moving n leading bytes to the right, zeroing the rest.
+            __attribute__((target("sse4.1")))
+            static inline __m128i align(size_t n) {
+                return _mm_add_epi8(
+                        _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7,
+                                      8, 9, 10, 11, 12, 13, 14, 15),
+                        _mm_set1_epi8(static_cast<char>(n - 16)));
+            }
+
+            /// Sum 16 right-aligned digit values into their u64t value.
+            __attribute__((target("sse4.1")))
+            static inline u64t sum16(__m128i x) {
+                __m128i m = _mm_maddubs_epi16(x, _mm_set1_epi16(0x010A));
+                m = _mm_madd_epi16(m, _mm_set1_epi32(0x00010064));
+                m = _mm_packus_epi32(m, m);
+                m = _mm_madd_epi16(m, _mm_set1_epi32(0x00012710));
+                return u64t(u32t(_mm_cvtsi128_si32(m))) * p8 +
+                       u32t(_mm_extract_epi32(m, 1));
+            }
+
+            /// Combine head h (columns 16..19) and tail v as the columns do:
+            /// overflow, a value above r or a value below b is an error.
+            static inline u64t &finish(
+                    u64r ull, s08pr s, u64t &e,                     // NOLINT
+                    size_t d, u64t r, u64t b, u64t h, u64t v) {
+                if (h > (top - v) / pG || (v += h * pG) > r || v < b) {
+                    e |= one;
+                    return ull = zip;
+                }
+                s += d;
+                return ull = v;
+            }
+#endif
+};
+
+#if LETTVIN_LEXDEC_SIMD
+    template <typename T>
+    typename decKernel<T>::kernel_t decKernel<T>::kernel =
+        lexDecU64t::cpuid();
+#endif
+
+    static lexDecU64t lexDecU64_Instance;
+
+    ///########################################################################
+    /// Decimal lexer for any integral T with the lexDecU64t contract:
+    /// (value, s, e, d, hi, lo), no lexing once e is set, s advanced only
+    /// on success.  For signed T the d characters may begin with '-' or
+    /// '+'.  The magnitude is summed in U against the remaining limit r as
+    /// in lexDecU64t, so overflow is found in the column it happens; r
+    /// starts at hi for unsigned T and at |min| or max for signed T, whose
+    /// hi/lo are tested once the sign is applied.  Unlike lexDecU64t, a
+    /// non-digit among the d characters is an error: the strict tables
+    /// flag it in the column where it is met.
+    /// The switch is unrolled only as deep as D for each T.
+    template <typename T, bool F = std::is_floating_point<T>::value>
+    class lexDec;
+
+    template <typename T>
+    class lexDec<T, false> : private decTable<T, true> {
+     public:
+        typedef typename decLimits<T>::U U;
+        static const size_t D = decLimits<T>::D;
+        static const bool sign = decLimits<T>::sign;
+
+        inline T &operator()(
+                T &v,                                               // NOLINT
+                s08pr s,
+                u64t &e,                                            // NOLINT
+                size_t d = D + sign,
+                T hi = std::numeric_limits<T>::max(),
+                T lo = std::numeric_limits<T>::min()) {
+            s08p o = s;
+            U m = 0, r = U(hi);
+            bool neg = false;
+
+            if (sign && d && (*s == '-' || *s == '+')) {
+                neg = (*s++ == '-');
+                e |= !--d;            ///< a sign alone is an error
+            }
+            if (sign) r = U(decLimits<T>::top - !neg);
+            if ((e |= (d > D))) goto err;
+            switch (d) {
+#define DECTCASE(n) \
+            case n + 1: if (n < D) column<(n < D ? n : 0)>(m, s, e, r)
+            DECTCASE(19); LETTVIN_FALLTHROUGH;
+            DECTCASE(18); LETTVIN_FALLTHROUGH;
+            DECTCASE(17); LETTVIN_FALLTHROUGH;
+            DECTCASE(16); LETTVIN_FALLTHROUGH;
+            DECTCASE(15); LETTVIN_FALLTHROUGH;
+            DECTCASE(14); LETTVIN_FALLTHROUGH;
+            DECTCASE(13); LETTVIN_FALLTHROUGH;
+            DECTCASE(12); LETTVIN_FALLTHROUGH;
+            DECTCASE(11); LETTVIN_FALLTHROUGH;
+            DECTCASE(10); LETTVIN_FALLTHROUGH;
+            DECTCASE(9); LETTVIN_FALLTHROUGH;
+            DECTCASE(8); LETTVIN_FALLTHROUGH;
+            DECTCASE(7); LETTVIN_FALLTHROUGH;
+            DECTCASE(6); LETTVIN_FALLTHROUGH;
+            DECTCASE(5); LETTVIN_FALLTHROUGH;
+            DECTCASE(4); LETTVIN_FALLTHROUGH;
+            DECTCASE(3); LETTVIN_FALLTHROUGH;
+            DECTCASE(2); LETTVIN_FALLTHROUGH;
+            DECTCASE(1); LETTVIN_FALLTHROUGH;
+            DECTCASE(0);
+                break;
+            default: goto err;        ///< d == 0 as in lexDecU64t
+            }
+            v = neg && m ? T(-T(m - 1) - 1) : T(m);
+            e |= (v < lo) || (v > hi);
+            if (!e) return v;
+err:        s = o;                    ///< On failure, restore the pointer
+            return v = 0;
+        }
+
+#ifdef LETTVIN_LEXERS_H_CPP_UNIT
+        /// Show edge cases derived from the limits of T, then compare
+        /// random fields with lexDecU64t plus a range test.
+        void UnitTest(const char *name) {
+            std::string top = show(std::numeric_limits<T>::max());
+            std::string low = show(std::numeric_limits<T>::min());
+            std::cout << "lexDec<" << name << "> " << D << " digits " <<
+                low << ".." << top << std::endl;
+            std::string test[] = {
+                "0", "7", top, above(top), std::string(D, '9'),
+                std::string(D + 1, '1'), "+7", "-0", "-", low, above(low),
+                "12x"
+            };
+            for (size_t i = 0; i < sizeof(test) / sizeof(*test); ++i) {
+                UnitTest(test[i], test[i].size());
+            }
+            UnitTest("42", 2, 41, 0);
+            UnitTest("42", 2, 100, 42);
+
+            size_t cases = 0, mismatches = 0;
+            u64t x = 20080505ULL;   ///< LCG state
+            for (size_t k = 0; k < 4000; ++k) {
+                char buffer[32];
+                x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+                size_t d = 1 + (x >> 33) % (D + 1), n = 0;
+                if (sign && (x >> 40) % 3 == 0) buffer[n++] = '-';
+                for (size_t i = 0; i < d; ++i) {
+                    x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+                    buffer[n++] = static_cast<char>('0' + (x >> 33) % 10);
+                }
+                if ((x >> 50) % 2) memcpy(buffer + n - d, top.c_str() +
+                        (top[0] == '-'), top.size() < d ? top.size() : d);
+                buffer[n] = 0;
+                u64t mag = 0, werr = 0;
+                char *w = buffer + (buffer[0] == '-');
+                lexDecU64_Instance(mag, w, werr, d);
+                bool minus = buffer[0] == '-';
+                werr |= d > D;
+                werr |= mag > u64t(decLimits<T>::top) - (sign && !minus);
+                T want = werr ? 0 :
+                    minus && mag ? T(-T(mag - 1) - 1) : T(mag);
+                if (werr) w = buffer;
+                T got = 7;
+                u64t gerr = 0;
+                char *g = buffer;
+                (*this)(got, g, gerr, n);
+                mismatches += got != want || gerr != werr || g != w;
+                ++cases;
+            }
+            std::cout << "lexDec<" << name << ">: " << cases << " cases " <<
+                mismatches << " mismatches" << std::endl;
+        }
+
+        void UnitTest(
+                const std::string &in, size_t d,
+                T hi = std::numeric_limits<T>::max(),
+                T lo = std::numeric_limits<T>::min()) {
+            char buffer[32];
+            strcpy(buffer, in.c_str());  // NOLINT
+            char *t = buffer;
+            u64t error = 0;
+            T v = 7;
+            (*this)(v, t, error, d, hi, lo);
+            std::cout <<
+                std::setw(21) << in <<
+                std::setw(21) << show(v) << " " <<
+                std::setw(2) << (t - buffer) << " " <<
+                error << std::endl;
+        }
+
+        static std::string show(T v) {
+            std::stringstream ss;
+            if (sign) ss << static_cast<s64t>(v);
+            else      ss << static_cast<u64t>(v);
+            return ss.str();
+        }
+
+        /// The decimal string one beyond a limit, away from zero.
+        static std::string above(std::string n) {
+            size_t i = n.size();
+            while (i-- && n[i] != '-') {
+                if (n[i] != '9') { ++n[i]; return n; }
+                n[i] = '0';
+            }
+            return n.insert(i + 1, "1");
+        }
+#endif
+
+     private:
+        template <size_t N>
+        inline void column(U &m, s08pr s, u64t &e, U &r) {  // NOLINT
+            U t;
+            e ||
+            (e |= this->inv[N][static_cast<u08t>(*s)]) ||
+            (e |= ((t = this->col[N][static_cast<u08t>(*s)]) > r)) ||
+            ((r -= t), (m += t), (++s));
+        }
+    };
+
+    typedef lexDec<u08t> lexDecU08t;
+    typedef lexDec<s08t> lexDecS08t;
+    typedef lexDec<u16t> lexDecU16t;
+    typedef lexDec<s16t> lexDecS16t;
+    typedef lexDec<u32t> lexDecU32t;
+    typedef lexDec<s32t> lexDecS32t;
+    typedef lexDec<s64t> lexDecS64t;
+
+    static lexDecU08t lexDecU08_Instance;
+    static lexDecS08t lexDecS08_Instance;
+    static lexDecU16t lexDecU16_Instance;
+    static lexDecS16t lexDecS16_Instance;
+    static lexDecU32t lexDecU32_Instance;
+    static lexDecS32t lexDecS32_Instance;
+    static lexDecS64t lexDecS64_Instance;
+
+#ifdef __SIZEOF_INT128__
+    ///########################################################################
+    /// lexDecU128t: d decimal digits (1..39) at s into u128t, for IDs and
+    /// nanosecond-plus-sequence keys too long for lexDecU64t.  The
+    /// contract is lexDecU64t's: e set on entry does nothing, d == 0
+    /// yields 0 without error, and on any error (d > 39, a top digit above
+    /// 3, a value above 340282366920938463463374607431768211455, above hi or
+    /// below lo) e |= 1, s is restored and v is 0.  Non-digits count as 0,
+    /// as there.  The digits are summed in 64 bit halves of at most 19
+    /// through the decTable<u64t> columns, which cannot overflow; the
+    /// halves meet in one 64 x 64 -> 128 bit multiply by 10^19, and only
+    /// a 39 digit field needs the 128 bit overflow test.
+    class lexDecU128t : private decTable<u64t> {
+     public:
+        static const size_t D = 39;
+
+        inline u128t &operator()(
+                u128r v,
+                s08pr s,
+                u64t &e,                                            // NOLINT
+                size_t d = D,
+                u128t hi = ~u128t(0),
+                u128t lo = 0) {
+            if ((e |= (d > D))) return v = 0;   ///< also when e was set
+            switch (d) {
+            case 0:
+                return v = 0;     ///< as lexDecU64t: no digits, no error
+            case D: {
+                const u64t t = col[0][static_cast<u08t>(*s)];
+                const u128t w = wide(s + 1, 19);
+                if ((e |= t > 3 || w > ~u128t(0) - t * big())) return v = 0;
+                v = t * big() + w;
+                break;
+            }
+            default:
+                v = d > 19 ? wide(s, d - 19) : u128t(sum(s, d));
+            }
+            if ((e |= v > hi || v < lo)) return v = 0;
+            s += d;
+            return v;
+        }
+
+#ifdef LETTVIN_LEXERS_H_CPP_UNIT
+        /// Edge cases around the limits, shown as value, d, advance and
+        /// e (the inputs are too wide to print beside them), then random
+        /// fields of 1 to 40 digits compared with a digit loop.
+        void UnitTest() {
+            const std::string top = show(~u128t(0));
+            std::cout << "lexDecU128t " << D << " digits 0.." << top <<
+                std::endl;
+            const std::string test[] = {
+                "0", "7", std::string(19, '9'), "18446744073709551616",
+                std::string(38, '9'), top,
+                "340282366920938463463374607431768211456",
+                std::string(D, '9'), "4" + std::string(D - 1, '0'),
+                std::string(D + 1, '1'), "12x"
+            };
+            for (size_t i = 0; i < sizeof(test) / sizeof(*test); ++i) {
+                UnitTest(test[i], test[i].size());
+            }
+            UnitTest("12345678901234567890123", 23, 1, 0);
+            UnitTest("42", 2, 100, 43);
+            UnitTest("42", 0);
+
+            size_t cases = 0, mismatches = 0;
+            u64t x = 20180711ULL;   ///< LCG state
+            for (size_t k = 0; k < 4000; ++k) {
+                char buffer[48];
+                x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+                const size_t d = 1 + (x >> 33) % (D + 1);
+                for (size_t i = 0; i < d; ++i) {
+                    x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+                    buffer[i] = static_cast<char>('0' + (x >> 33) % 10);
+                }
+                const size_t p = (x >> 50) % 4 ? 0 : (x >> 40) % D;
+                if (d == D) memcpy(buffer, top.c_str(), p);
+                buffer[d] = 0;
+                u128t want = 0;
+                u64t werr = d > D;
+                for (size_t i = 0; i < d && !werr; ++i) {
+                    werr |= __builtin_mul_overflow(want, 10, &want) ||
+                        __builtin_add_overflow(want, buffer[i] - '0', &want);
+                }
+                if (werr) want = 0;
+                u128t got = 7;
+                u64t gerr = 0;
+                char *g = buffer;
+                (*this)(got, g, gerr, d);
+                mismatches += got != want || gerr != werr ||
+                    g != buffer + (werr ? 0 : d);
+                ++cases;
+            }
+            std::cout << "lexDecU128t: " << cases << " cases " <<
+                mismatches << " mismatches" << std::endl;
+        }
+
+        void UnitTest(const std::string &in, size_t d,
+                u128t hi = ~u128t(0), u128t lo = 0) {
+            char buffer[48];
+            strcpy(buffer, in.c_str());  // NOLINT
+            char *t = buffer;
+            u64t error = 0;
+            u128t v = 7;
+            (*this)(v, t, error, d, hi, lo);
+            std::cout <<
+                std::setw(40) << show(v) << " " <<
+                std::setw(2) << d << " " <<
+                std::setw(2) << (t - buffer) << " " <<
+                error << std::endl;
+        }
+
+        static std::string show(u128t v) {
+            std::string n;
+            do n.insert(n.begin(), char('0' + v % 10)); while (v /= 10);
+            return n;
+        }
+#endif
+
+     private:
+        /// 10^19 and 10^38, the weights of the upper halves.
+        static inline u64t ten() { return decPower(19); }
+        static inline u128t big() { return u128t(ten()) * ten(); }
+
+        /// Sum n <= 19 digits at p; at most 10^19 - 1, so no check.
+        static inline u64t sum(const char *p, size_t n) {
+            u64t w = 0;
+            for (const u08t *c = reinterpret_cast<const u08t *>(p); n; ++c) {
+                w += col[--n][*c];
+            }
+            return w;
+        }
+
+        /// n digits, then 19 more: (n + 19) digits in two halves.
+        static inline u128t wide(const char *p, size_t n) {
+            return u128t(sum(p, n)) * ten() + sum(p + n, 19);
+        }
+    };
+
+    static lexDecU128t lexDecU128_Instance;
+#endif
+
+    ///########################################################################
+    /// Binary formats of the floating-point lexers, as Eisel-Lemire needs.
+    /// M: explicit mantissa bits.  bias: exponent bias.  inf: exponent of
+    /// infinity.  even: q range where round-to-even ties can be exact.
+    /// low/high: q below/above which every w * 10^q is 0/infinite.
+    /// fast/wide: Clinger's exact range for 10^|q| and w.
+    template <typename F> struct fltLimits;
+    template <> struct fltLimits<f64t> {
+        typedef u64t B;
+        enum { M = 52, bias = -1023, inf = 0x7FF, evenlo = -4, evenhi = 23,
+               low = -342, high = 308, fast = 22 };
+        static constexpr u64t wide = 1ULL << 53;
+        static f64t strto(const char *s) { return strtod(s, 0); }
+    };
+    template <> struct fltLimits<f32t> {
+        typedef u32t B;
+        enum { M = 23, bias = -127, inf = 0xFF, evenlo = -17, evenhi = 10,
+               low = -64, high = 38, fast = 10 };
+        static constexpr u64t wide = 1ULL << 24;
+        static f32t strto(const char *s) { return strtof(s, 0); }
+    };
+
+    /// 128 bit truncations of 5^q for q in -342..308, most significant
+    /// word first; entries for q < 0 are 2^b / 5^-q + 1, then truncated.
+    template <int N = 0> struct decPow5 { static const u64t t[651][2]; };
+
+    template <int N> const u64t decPow5<N>::t[651][2] = {
+        {0xeef453d6923bd65aULL, 0x113faa2906a13b3fULL},  // 5^-342
+        {0x9558b4661b6565f8ULL, 0x4ac7ca59a424c507ULL},  // 5^-341
+        {0xbaaee17fa23ebf76ULL, 0x5d79bcf00d2df649ULL},  // 5^-340
+        {0xe95a99df8ace6f53ULL, 0xf4d82c2c107973dcULL},  // 5^-339
+        {0x91d8a02bb6c10594ULL, 0x79071b9b8a4be869ULL},  // 5^-338
+        {0xb64ec836a47146f9ULL, 0x9748e2826cdee284ULL},  // 5^-337
+        {0xe3e27a444d8d98b7ULL, 0xfd1b1b2308169b25ULL},  // 5^-336
+        {0x8e6d8c6ab0787f72ULL, 0xfe30f0f5e50e20f7ULL},  // 5^-335
+        {0xb208ef855c969f4fULL, 0xbdbd2d335e51a935ULL},  // 5^-334
+        {0xde8b2b66b3bc4723ULL, 0xad2c788035e61382ULL},  // 5^-333
+        {0x8b16fb203055ac76ULL, 0x4c3bcb5021afcc31ULL},  // 5^-332
+        {0xaddcb9e83c6b1793ULL, 0xdf4abe242a1bbf3dULL},  // 5^-331
+        {0xd953e8624b85dd78ULL, 0xd71d6dad34a2af0dULL},  // 5^-330
+        {0x87d4713d6f33aa6bULL, 0x8672648c40e5ad68ULL},  // 5^-329
+        {0xa9c98d8ccb009506ULL, 0x680efdaf511f18c2ULL},  // 5^-328
+        {0xd43bf0effdc0ba48ULL, 0x0212bd1b2566def2ULL},  // 5^-327
+        {0x84a57695fe98746dULL, 0x014bb630f7604b57ULL},  // 5^-326
+        {0xa5ced43b7e3e9188ULL, 0x419ea3bd35385e2dULL},  // 5^-325
+        {0xcf42894a5dce35eaULL, 0x52064cac828675b9ULL},  // 5^-324
+        {0x818995ce7aa0e1b2ULL, 0x7343efebd1940993ULL},  // 5^-323
+        {0xa1ebfb4219491a1fULL, 0x1014ebe6c5f90bf8ULL},  // 5^-322
+        {0xca66fa129f9b60a6ULL, 0xd41a26e077774ef6ULL},  // 5^-321
+        {0xfd00b897478238d0ULL, 0x8920b098955522b4ULL},  // 5^-320
+        {0x9e20735e8cb16382ULL, 0x55b46e5f5d5535b0ULL},  // 5^-319
+        {0xc5a890362fddbc62ULL, 0xeb2189f734aa831dULL},  // 5^-318
+        {0xf712b443bbd52b7bULL, 0xa5e9ec7501d523e4ULL},  // 5^-317
+        {0x9a6bb0aa55653b2dULL, 0x47b233c92125366eULL},  // 5^-316
+        {0xc1069cd4eabe89f8ULL, 0x999ec0bb696e840aULL},  // 5^-315
+        {0xf148440a256e2c76ULL, 0xc00670ea43ca250dULL},  // 5^-314
+        {0x96cd2a865764dbcaULL, 0x380406926a5e5728ULL},  // 5^-313
+        {0xbc807527ed3e12bcULL, 0xc605083704f5ecf2ULL},  // 5^-312
+        {0xeba09271e88d976bULL, 0xf7864a44c633682eULL},  // 5^-311
+        {0x93445b8731587ea3ULL, 0x7ab3ee6afbe0211dULL},  // 5^-310
+        {0xb8157268fdae9e4cULL, 0x5960ea05bad82964ULL},  // 5^-309
+        {0xe61acf033d1a45dfULL, 0x6fb92487298e33bdULL},  // 5^-308
+        {0x8fd0c16206306babULL, 0xa5d3b6d479f8e056ULL},  // 5^-307
+        {0xb3c4f1ba87bc8696ULL, 0x8f48a4899877186cULL},  // 5^-306
+        {0xe0b62e2929aba83cULL, 0x331acdabfe94de87ULL},  // 5^-305
+        {0x8c71dcd9ba0b4925ULL, 0x9ff0c08b7f1d0b14ULL},  // 5^-304
+        {0xaf8e5410288e1b6fULL, 0x07ecf0ae5ee44dd9ULL},  // 5^-303
+        {0xdb71e91432b1a24aULL, 0xc9e82cd9f69d6150ULL},  // 5^-302
+        {0x892731ac9faf056eULL, 0xbe311c083a225cd2ULL},  // 5^-301
+        {0xab70fe17c79ac6caULL, 0x6dbd630a48aaf406ULL},  // 5^-300
+        {0xd64d3d9db981787dULL, 0x092cbbccdad5b108ULL},  // 5^-299
+        {0x85f0468293f0eb4eULL, 0x25bbf56008c58ea5ULL},  // 5^-298
+        {0xa76c582338ed2621ULL, 0xaf2af2b80af6f24eULL},  // 5^-297
+        {0xd1476e2c07286faaULL, 0x1af5af660db4aee1ULL},  // 5^-296
+        {0x82cca4db847945caULL, 0x50d98d9fc890ed4dULL},  // 5^-295
+        {0xa37fce126597973cULL, 0xe50ff107bab528a0ULL},  // 5^-294
+        {0xcc5fc196fefd7d0cULL, 0x1e53ed49a96272c8ULL},  // 5^-293
+        {0xff77b1fcbebcdc4fULL, 0x25e8e89c13bb0f7aULL},  // 5^-292
+        {0x9faacf3df73609b1ULL, 0x77b191618c54e9acULL},  // 5^-291
+        {0xc795830d75038c1dULL, 0xd59df5b9ef6a2417ULL},  // 5^-290
+        {0xf97ae3d0d2446f25ULL, 0x4b0573286b44ad1dULL},  // 5^-289
+        {0x9becce62836ac577ULL, 0x4ee367f9430aec32ULL},  // 5^-288
+        {0xc2e801fb244576d5ULL, 0x229c41f793cda73fULL},  // 5^-287
+        {0xf3a20279ed56d48aULL, 0x6b43527578c1110fULL},  // 5^-286
+        {0x9845418c345644d6ULL, 0x830a13896b78aaa9ULL},  // 5^-285
+        {0xbe5691ef416bd60cULL, 0x23cc986bc656d553ULL},  // 5^-284
+        {0xedec366b11c6cb8fULL, 0x2cbfbe86b7ec8aa8ULL},  // 5^-283
+        {0x94b3a202eb1c3f39ULL, 0x7bf7d71432f3d6a9ULL},  // 5^-282
+        {0xb9e08a83a5e34f07ULL, 0xdaf5ccd93fb0cc53ULL},  // 5^-281
+        {0xe858ad248f5c22c9ULL, 0xd1b3400f8f9cff68ULL},  // 5^-280
+        {0x91376c36d99995beULL, 0x23100809b9c21fa1ULL},  // 5^-279
+        {0xb58547448ffffb2dULL, 0xabd40a0c2832a78aULL},  // 5^-278
+        {0xe2e69915b3fff9f9ULL, 0x16c90c8f323f516cULL},  // 5^-277
+        {0x8dd01fad907ffc3bULL, 0xae3da7d97f6792e3ULL},  // 5^-276
+        {0xb1442798f49ffb4aULL, 0x99cd11cfdf41779cULL},  // 5^-275
+        {0xdd95317f31c7fa1dULL, 0x40405643d711d583ULL},  // 5^-274
+        {0x8a7d3eef7f1cfc52ULL, 0x482835ea666b2572ULL},  // 5^-273
+        {0xad1c8eab5ee43b66ULL, 0xda3243650005eecfULL},  // 5^-272
+        {0xd863b256369d4a40ULL, 0x90bed43e40076a82ULL},  // 5^-271
+        {0x873e4f75e2224e68ULL, 0x5a7744a6e804a291ULL},  // 5^-270
+        {0xa90de3535aaae202ULL, 0x711515d0a205cb36ULL},  // 5^-269
+        {0xd3515c2831559a83ULL, 0x0d5a5b44ca873e03ULL},  // 5^-268
+        {0x8412d9991ed58091ULL, 0xe858790afe9486c2ULL},  // 5^-267
+        {0xa5178fff668ae0b6ULL, 0x626e974dbe39a872ULL},  // 5^-266
+        {0xce5d73ff402d98e3ULL, 0xfb0a3d212dc8128fULL},  // 5^-265
+        {0x80fa687f881c7f8eULL, 0x7ce66634bc9d0b99ULL},  // 5^-264
+        {0xa139029f6a239f72ULL, 0x1c1fffc1ebc44e80ULL},  // 5^-263
+        {0xc987434744ac874eULL, 0xa327ffb266b56220ULL},  // 5^-262
+        {0xfbe9141915d7a922ULL, 0x4bf1ff9f0062baa8ULL},  // 5^-261
+        {0x9d71ac8fada6c9b5ULL, 0x6f773fc3603db4a9ULL},  // 5^-260
+        {0xc4ce17b399107c22ULL, 0xcb550fb4384d21d3ULL},  // 5^-259
+        {0xf6019da07f549b2bULL, 0x7e2a53a146606a48ULL},  // 5^-258
+        {0x99c102844f94e0fbULL, 0x2eda7444cbfc426dULL},  // 5^-257
+        {0xc0314325637a1939ULL, 0xfa911155fefb5308ULL},  // 5^-256
+        {0xf03d93eebc589f88ULL, 0x793555ab7eba27caULL},  // 5^-255
+        {0x96267c7535b763b5ULL, 0x4bc1558b2f3458deULL},  // 5^-254
+        {0xbbb01b9283253ca2ULL, 0x9eb1aaedfb016f16ULL},  // 5^-253
+        {0xea9c227723ee8bcbULL, 0x465e15a979c1cadcULL},  // 5^-252
+        {0x92a1958a7675175fULL, 0x0bfacd89ec191ec9ULL},  // 5^-251
+        {0xb749faed14125d36ULL, 0xcef980ec671f667bULL},  // 5^-250
+        {0xe51c79a85916f484ULL, 0x82b7e12780e7401aULL},  // 5^-249
+        {0x8f31cc0937ae58d2ULL, 0xd1b2ecb8b0908810ULL},  // 5^-248
+        {0xb2fe3f0b8599ef07ULL, 0x861fa7e6dcb4aa15ULL},  // 5^-247
+        {0xdfbdcece67006ac9ULL, 0x67a791e093e1d49aULL},  // 5^-246
+        {0x8bd6a141006042bdULL, 0xe0c8bb2c5c6d24e0ULL},  // 5^-245
+        {0xaecc49914078536dULL, 0x58fae9f773886e18ULL},  // 5^-244
+        {0xda7f5bf590966848ULL, 0xaf39a475506a899eULL},  // 5^-243
+        {0x888f99797a5e012dULL, 0x6d8406c952429603ULL},  // 5^-242
+        {0xaab37fd7d8f58178ULL, 0xc8e5087ba6d33b83ULL},  // 5^-241
+        {0xd5605fcdcf32e1d6ULL, 0xfb1e4a9a90880a64ULL},  // 5^-240
+        {0x855c3be0a17fcd26ULL, 0x5cf2eea09a55067fULL},  // 5^-239
+        {0xa6b34ad8c9dfc06fULL, 0xf42faa48c0ea481eULL},  // 5^-238
+        {0xd0601d8efc57b08bULL, 0xf13b94daf124da26ULL},  // 5^-237
+        {0x823c12795db6ce57ULL, 0x76c53d08d6b70858ULL},  // 5^-236
+        {0xa2cb1717b52481edULL, 0x54768c4b0c64ca6eULL},  // 5^-235
+        {0xcb7ddcdda26da268ULL, 0xa9942f5dcf7dfd09ULL},  // 5^-234
+        {0xfe5d54150b090b02ULL, 0xd3f93b35435d7c4cULL},  // 5^-233
+        {0x9efa548d26e5a6e1ULL, 0xc47bc5014a1a6dafULL},  // 5^-232
+        {0xc6b8e9b0709f109aULL, 0x359ab6419ca1091bULL},  // 5^-231
+        {0xf867241c8cc6d4c0ULL, 0xc30163d203c94b62ULL},  // 5^-230
+        {0x9b407691d7fc44f8ULL, 0x79e0de63425dcf1dULL},  // 5^-229
+        {0xc21094364dfb5636ULL, 0x985915fc12f542e4ULL},  // 5^-228
+        {0xf294b943e17a2bc4ULL, 0x3e6f5b7b17b2939dULL},  // 5^-227
+        {0x979cf3ca6cec5b5aULL, 0xa705992ceecf9c42ULL},  // 5^-226
+        {0xbd8430bd08277231ULL, 0x50c6ff782a838353ULL},  // 5^-225
+        {0xece53cec4a314ebdULL, 0xa4f8bf5635246428ULL},  // 5^-224
+        {0x940f4613ae5ed136ULL, 0x871b7795e136be99ULL},  // 5^-223
+        {0xb913179899f68584ULL, 0x28e2557b59846e3fULL},  // 5^-222
+        {0xe757dd7ec07426e5ULL, 0x331aeada2fe589cfULL},  // 5^-221
+        {0x9096ea6f3848984fULL, 0x3ff0d2c85def7621ULL},  // 5^-220
+        {0xb4bca50b065abe63ULL, 0x0fed077a756b53a9ULL},  // 5^-219
+        {0xe1ebce4dc7f16dfbULL, 0xd3e8495912c62894ULL},  // 5^-218
+        {0x8d3360f09cf6e4bdULL, 0x64712dd7abbbd95cULL},  // 5^-217
+        {0xb080392cc4349decULL, 0xbd8d794d96aacfb3ULL},  // 5^-216
+        {0xdca04777f541c567ULL, 0xecf0d7a0fc5583a0ULL},  // 5^-215
+        {0x89e42caaf9491b60ULL, 0xf41686c49db57244ULL},  // 5^-214
+        {0xac5d37d5b79b6239ULL, 0x311c2875c522ced5ULL},  // 5^-213
+        {0xd77485cb25823ac7ULL, 0x7d633293366b828bULL},  // 5^-212
+        {0x86a8d39ef77164bcULL, 0xae5dff9c02033197ULL},  // 5^-211
+        {0xa8530886b54dbdebULL, 0xd9f57f830283fdfcULL},  // 5^-210
+        {0xd267caa862a12d66ULL, 0xd072df63c324fd7bULL},  // 5^-209
+        {0x8380dea93da4bc60ULL, 0x4247cb9e59f71e6dULL},  // 5^-208
+        {0xa46116538d0deb78ULL, 0x52d9be85f074e608ULL},  // 5^-207
+        {0xcd795be870516656ULL, 0x67902e276c921f8bULL},  // 5^-206
+        {0x806bd9714632dff6ULL, 0x00ba1cd8a3db53b6ULL},  // 5^-205
+        {0xa086cfcd97bf97f3ULL, 0x80e8a40eccd228a4ULL},  // 5^-204
+        {0xc8a883c0fdaf7df0ULL, 0x6122cd128006b2cdULL},  // 5^-203
+        {0xfad2a4b13d1b5d6cULL, 0x796b805720085f81ULL},  // 5^-202
+        {0x9cc3a6eec6311a63ULL, 0xcbe3303674053bb0ULL},  // 5^-201
+        {0xc3f490aa77bd60fcULL, 0xbedbfc4411068a9cULL},  // 5^-200
+        {0xf4f1b4d515acb93bULL, 0xee92fb5515482d44ULL},  // 5^-199
+        {0x991711052d8bf3c5ULL, 0x751bdd152d4d1c4aULL},  // 5^-198
+        {0xbf5cd54678eef0b6ULL, 0xd262d45a78a0635dULL},  // 5^-197
+        {0xef340a98172aace4ULL, 0x86fb897116c87c34ULL},  // 5^-196
+        {0x9580869f0e7aac0eULL, 0xd45d35e6ae3d4da0ULL},  // 5^-195
+        {0xbae0a846d2195712ULL, 0x8974836059cca109ULL},  // 5^-194
+        {0xe998d258869facd7ULL, 0x2bd1a438703fc94bULL},  // 5^-193
+        {0x91ff83775423cc06ULL, 0x7b6306a34627ddcfULL},  // 5^-192
+        {0xb67f6455292cbf08ULL, 0x1a3bc84c17b1d542ULL},  // 5^-191
+        {0xe41f3d6a7377eecaULL, 0x20caba5f1d9e4a93ULL},  // 5^-190
+        {0x8e938662882af53eULL, 0x547eb47b7282ee9cULL},  // 5^-189
+        {0xb23867fb2a35b28dULL, 0xe99e619a4f23aa43ULL},  // 5^-188
+        {0xdec681f9f4c31f31ULL, 0x6405fa00e2ec94d4ULL},  // 5^-187
+        {0x8b3c113c38f9f37eULL, 0xde83bc408dd3dd04ULL},  // 5^-186
+        {0xae0b158b4738705eULL, 0x9624ab50b148d445ULL},  // 5^-185
+        {0xd98ddaee19068c76ULL, 0x3badd624dd9b0957ULL},  // 5^-184
+        {0x87f8a8d4cfa417c9ULL, 0xe54ca5d70a80e5d6ULL},  // 5^-183
+        {0xa9f6d30a038d1dbcULL, 0x5e9fcf4ccd211f4cULL},  // 5^-182
+        {0xd47487cc8470652bULL, 0x7647c3200069671fULL},  // 5^-181
+        {0x84c8d4dfd2c63f3bULL, 0x29ecd9f40041e073ULL},  // 5^-180
+        {0xa5fb0a17c777cf09ULL, 0xf468107100525890ULL},  // 5^-179
+        {0xcf79cc9db955c2ccULL, 0x7182148d4066eeb4ULL},  // 5^-178
+        {0x81ac1fe293d599bfULL, 0xc6f14cd848405530ULL},  // 5^-177
+        {0xa21727db38cb002fULL, 0xb8ada00e5a506a7cULL},  // 5^-176
+        {0xca9cf1d206fdc03bULL, 0xa6d90811f0e4851cULL},  // 5^-175
+        {0xfd442e4688bd304aULL, 0x908f4a166d1da663ULL},  // 5^-174
+        {0x9e4a9cec15763e2eULL, 0x9a598e4e043287feULL},  // 5^-173
+        {0xc5dd44271ad3cdbaULL, 0x40eff1e1853f29fdULL},  // 5^-172
+        {0xf7549530e188c128ULL, 0xd12bee59e68ef47cULL},  // 5^-171
+        {0x9a94dd3e8cf578b9ULL, 0x82bb74f8301958ceULL},  // 5^-170
+        {0xc13a148e3032d6e7ULL, 0xe36a52363c1faf01ULL},  // 5^-169
+        {0xf18899b1bc3f8ca1ULL, 0xdc44e6c3cb279ac1ULL},  // 5^-168
+        {0x96f5600f15a7b7e5ULL, 0x29ab103a5ef8c0b9ULL},  // 5^-167
+        {0xbcb2b812db11a5deULL, 0x7415d448f6b6f0e7ULL},  // 5^-166
+        {0xebdf661791d60f56ULL, 0x111b495b3464ad21ULL},  // 5^-165
+        {0x936b9fcebb25c995ULL, 0xcab10dd900beec34ULL},  // 5^-164
+        {0xb84687c269ef3bfbULL, 0x3d5d514f40eea742ULL},  // 5^-163
+        {0xe65829b3046b0afaULL, 0x0cb4a5a3112a5112ULL},  // 5^-162
+        {0x8ff71a0fe2c2e6dcULL, 0x47f0e785eaba72abULL},  // 5^-161
+        {0xb3f4e093db73a093ULL, 0x59ed216765690f56ULL},  // 5^-160
+        {0xe0f218b8d25088b8ULL, 0x306869c13ec3532cULL},  // 5^-159
+        {0x8c974f7383725573ULL, 0x1e414218c73a13fbULL},  // 5^-158
+        {0xafbd2350644eeacfULL, 0xe5d1929ef90898faULL},  // 5^-157
+        {0xdbac6c247d62a583ULL, 0xdf45f746b74abf39ULL},  // 5^-156
+        {0x894bc396ce5da772ULL, 0x6b8bba8c328eb783ULL},  // 5^-155
+        {0xab9eb47c81f5114fULL, 0x066ea92f3f326564ULL},  // 5^-154
+        {0xd686619ba27255a2ULL, 0xc80a537b0efefebdULL},  // 5^-153
+        {0x8613fd0145877585ULL, 0xbd06742ce95f5f36ULL},  // 5^-152
+        {0xa798fc4196e952e7ULL, 0x2c48113823b73704ULL},  // 5^-151
+        {0xd17f3b51fca3a7a0ULL, 0xf75a15862ca504c5ULL},  // 5^-150
+        {0x82ef85133de648c4ULL, 0x9a984d73dbe722fbULL},  // 5^-149
+        {0xa3ab66580d5fdaf5ULL, 0xc13e60d0d2e0ebbaULL},  // 5^-148
+        {0xcc963fee10b7d1b3ULL, 0x318df905079926a8ULL},  // 5^-147
+        {0xffbbcfe994e5c61fULL, 0xfdf17746497f7052ULL},  // 5^-146
+        {0x9fd561f1fd0f9bd3ULL, 0xfeb6ea8bedefa633ULL},  // 5^-145
+        {0xc7caba6e7c5382c8ULL, 0xfe64a52ee96b8fc0ULL},  // 5^-144
+        {0xf9bd690a1b68637bULL, 0x3dfdce7aa3c673b0ULL},  // 5^-143
+        {0x9c1661a651213e2dULL, 0x06bea10ca65c084eULL},  // 5^-142
+        {0xc31bfa0fe5698db8ULL, 0x486e494fcff30a62ULL},  // 5^-141
+        {0xf3e2f893dec3f126ULL, 0x5a89dba3c3efccfaULL},  // 5^-140
+        {0x986ddb5c6b3a76b7ULL, 0xf89629465a75e01cULL},  // 5^-139
+        {0xbe89523386091465ULL, 0xf6bbb397f1135823ULL},  // 5^-138
+        {0xee2ba6c0678b597fULL, 0x746aa07ded582e2cULL},  // 5^-137
+        {0x94db483840b717efULL, 0xa8c2a44eb4571cdcULL},  // 5^-136
+        {0xba121a4650e4ddebULL, 0x92f34d62616ce413ULL},  // 5^-135
+        {0xe896a0d7e51e1566ULL, 0x77b020baf9c81d17ULL},  // 5^-134
+        {0x915e2486ef32cd60ULL, 0x0ace1474dc1d122eULL},  // 5^-133
+        {0xb5b5ada8aaff80b8ULL, 0x0d819992132456baULL},  // 5^-132
+        {0xe3231912d5bf60e6ULL, 0x10e1fff697ed6c69ULL},  // 5^-131
+        {0x8df5efabc5979c8fULL, 0xca8d3ffa1ef463c1ULL},  // 5^-130
+        {0xb1736b96b6fd83b3ULL, 0xbd308ff8a6b17cb2ULL},  // 5^-129
+        {0xddd0467c64bce4a0ULL, 0xac7cb3f6d05ddbdeULL},  // 5^-128
+        {0x8aa22c0dbef60ee4ULL, 0x6bcdf07a423aa96bULL},  // 5^-127
+        {0xad4ab7112eb3929dULL, 0x86c16c98d2c953c6ULL},  // 5^-126
+        {0xd89d64d57a607744ULL, 0xe871c7bf077ba8b7ULL},  // 5^-125
+        {0x87625f056c7c4a8bULL, 0x11471cd764ad4972ULL},  // 5^-124
+        {0xa93af6c6c79b5d2dULL, 0xd598e40d3dd89bcfULL},  // 5^-123
+        {0xd389b47879823479ULL, 0x4aff1d108d4ec2c3ULL},  // 5^-122
+        {0x843610cb4bf160cbULL, 0xcedf722a585139baULL},  // 5^-121
+        {0xa54394fe1eedb8feULL, 0xc2974eb4ee658828ULL},  // 5^-120
+        {0xce947a3da6a9273eULL, 0x733d226229feea32ULL},  // 5^-119
+        {0x811ccc668829b887ULL, 0x0806357d5a3f525fULL},  // 5^-118
+        {0xa163ff802a3426a8ULL, 0xca07c2dcb0cf26f7ULL},  // 5^-117
+        {0xc9bcff6034c13052ULL, 0xfc89b393dd02f0b5ULL},  // 5^-116
+        {0xfc2c3f3841f17c67ULL, 0xbbac2078d443ace2ULL},  // 5^-115
+        {0x9d9ba7832936edc0ULL, 0xd54b944b84aa4c0dULL},  // 5^-114
+        {0xc5029163f384a931ULL, 0x0a9e795e65d4df11ULL},  // 5^-113
+        {0xf64335bcf065d37dULL, 0x4d4617b5ff4a16d5ULL},  // 5^-112
+        {0x99ea0196163fa42eULL, 0x504bced1bf8e4e45ULL},  // 5^-111
+        {0xc06481fb9bcf8d39ULL, 0xe45ec2862f71e1d6ULL},  // 5^-110
+        {0xf07da27a82c37088ULL, 0x5d767327bb4e5a4cULL},  // 5^-109
+        {0x964e858c91ba2655ULL, 0x3a6a07f8d510f86fULL},  // 5^-108
+        {0xbbe226efb628afeaULL, 0x890489f70a55368bULL},  // 5^-107
+        {0xeadab0aba3b2dbe5ULL, 0x2b45ac74ccea842eULL},  // 5^-106
+        {0x92c8ae6b464fc96fULL, 0x3b0b8bc90012929dULL},  // 5^-105
+        {0xb77ada0617e3bbcbULL, 0x09ce6ebb40173744ULL},  // 5^-104
+        {0xe55990879ddcaabdULL, 0xcc420a6a101d0515ULL},  // 5^-103
+        {0x8f57fa54c2a9eab6ULL, 0x9fa946824a12232dULL},  // 5^-102
+        {0xb32df8e9f3546564ULL, 0x47939822dc96abf9ULL},  // 5^-101
+        {0xdff9772470297ebdULL, 0x59787e2b93bc56f7ULL},  // 5^-100
+        {0x8bfbea76c619ef36ULL, 0x57eb4edb3c55b65aULL},  // 5^-99
+        {0xaefae51477a06b03ULL, 0xede622920b6b23f1ULL},  // 5^-98
+        {0xdab99e59958885c4ULL, 0xe95fab368e45ecedULL},  // 5^-97
+        {0x88b402f7fd75539bULL, 0x11dbcb0218ebb414ULL},  // 5^-96
+        {0xaae103b5fcd2a881ULL, 0xd652bdc29f26a119ULL},  // 5^-95
+        {0xd59944a37c0752a2ULL, 0x4be76d3346f0495fULL},  // 5^-94
+        {0x857fcae62d8493a5ULL, 0x6f70a4400c562ddbULL},  // 5^-93
+        {0xa6dfbd9fb8e5b88eULL, 0xcb4ccd500f6bb952ULL},  // 5^-92
+        {0xd097ad07a71f26b2ULL, 0x7e2000a41346a7a7ULL},  // 5^-91
+        {0x825ecc24c873782fULL, 0x8ed400668c0c28c8ULL},  // 5^-90
+        {0xa2f67f2dfa90563bULL, 0x728900802f0f32faULL},  // 5^-89
+        {0xcbb41ef979346bcaULL, 0x4f2b40a03ad2ffb9ULL},  // 5^-88
+        {0xfea126b7d78186bcULL, 0xe2f610c84987bfa8ULL},  // 5^-87
+        {0x9f24b832e6b0f436ULL, 0x0dd9ca7d2df4d7c9ULL},  // 5^-86
+        {0xc6ede63fa05d3143ULL, 0x91503d1c79720dbbULL},  // 5^-85
+        {0xf8a95fcf88747d94ULL, 0x75a44c6397ce912aULL},  // 5^-84
+        {0x9b69dbe1b548ce7cULL, 0xc986afbe3ee11abaULL},  // 5^-83
+        {0xc24452da229b021bULL, 0xfbe85badce996168ULL},  // 5^-82
+        {0xf2d56790ab41c2a2ULL, 0xfae27299423fb9c3ULL},  // 5^-81
+        {0x97c560ba6b0919a5ULL, 0xdccd879fc967d41aULL},  // 5^-80
+        {0xbdb6b8e905cb600fULL, 0x5400e987bbc1c920ULL},  // 5^-79
+        {0xed246723473e3813ULL, 0x290123e9aab23b68ULL},  // 5^-78
+        {0x9436c0760c86e30bULL, 0xf9a0b6720aaf6521ULL},  // 5^-77
+        {0xb94470938fa89bceULL, 0xf808e40e8d5b3e69ULL},  // 5^-76
+        {0xe7958cb87392c2c2ULL, 0xb60b1d1230b20e04ULL},  // 5^-75
+        {0x90bd77f3483bb9b9ULL, 0xb1c6f22b5e6f48c2ULL},  // 5^-74
+        {0xb4ecd5f01a4aa828ULL, 0x1e38aeb6360b1af3ULL},  // 5^-73
+        {0xe2280b6c20dd5232ULL, 0x25c6da63c38de1b0ULL},  // 5^-72
+        {0x8d590723948a535fULL, 0x579c487e5a38ad0eULL},  // 5^-71
+        {0xb0af48ec79ace837ULL, 0x2d835a9df0c6d851ULL},  // 5^-70
+        {0xdcdb1b2798182244ULL, 0xf8e431456cf88e65ULL},  // 5^-69
+        {0x8a08f0f8bf0f156bULL, 0x1b8e9ecb641b58ffULL},  // 5^-68
+        {0xac8b2d36eed2dac5ULL, 0xe272467e3d222f3fULL},  // 5^-67
+        {0xd7adf884aa879177ULL, 0x5b0ed81dcc6abb0fULL},  // 5^-66
+        {0x86ccbb52ea94baeaULL, 0x98e947129fc2b4e9ULL},  // 5^-65
+        {0xa87fea27a539e9a5ULL, 0x3f2398d747b36224ULL},  // 5^-64
+        {0xd29fe4b18e88640eULL, 0x8eec7f0d19a03aadULL},  // 5^-63
+        {0x83a3eeeef9153e89ULL, 0x1953cf68300424acULL},  // 5^-62
+        {0xa48ceaaab75a8e2bULL, 0x5fa8c3423c052dd7ULL},  // 5^-61
+        {0xcdb02555653131b6ULL, 0x3792f412cb06794dULL},  // 5^-60
+        {0x808e17555f3ebf11ULL, 0xe2bbd88bbee40bd0ULL},  // 5^-59
+        {0xa0b19d2ab70e6ed6ULL, 0x5b6aceaeae9d0ec4ULL},  // 5^-58
+        {0xc8de047564d20a8bULL, 0xf245825a5a445275ULL},  // 5^-57
+        {0xfb158592be068d2eULL, 0xeed6e2f0f0d56712ULL},  // 5^-56
+        {0x9ced737bb6c4183dULL, 0x55464dd69685606bULL},  // 5^-55
+        {0xc428d05aa4751e4cULL, 0xaa97e14c3c26b886ULL},  // 5^-54
+        {0xf53304714d9265dfULL, 0xd53dd99f4b3066a8ULL},  // 5^-53
+        {0x993fe2c6d07b7fabULL, 0xe546a8038efe4029ULL},  // 5^-52
+        {0xbf8fdb78849a5f96ULL, 0xde98520472bdd033ULL},  // 5^-51
+        {0xef73d256a5c0f77cULL, 0x963e66858f6d4440ULL},  // 5^-50
+        {0x95a8637627989aadULL, 0xdde7001379a44aa8ULL},  // 5^-49
+        {0xbb127c53b17ec159ULL, 0x5560c018580d5d52ULL},  // 5^-48
+        {0xe9d71b689dde71afULL, 0xaab8f01e6e10b4a6ULL},  // 5^-47
+        {0x9226712162ab070dULL, 0xcab3961304ca70e8ULL},  // 5^-46
+        {0xb6b00d69bb55c8d1ULL, 0x3d607b97c5fd0d22ULL},  // 5^-45
+        {0xe45c10c42a2b3b05ULL, 0x8cb89a7db77c506aULL},  // 5^-44
+        {0x8eb98a7a9a5b04e3ULL, 0x77f3608e92adb242ULL},  // 5^-43
+        {0xb267ed1940f1c61cULL, 0x55f038b237591ed3ULL},  // 5^-42
+        {0xdf01e85f912e37a3ULL, 0x6b6c46dec52f6688ULL},  // 5^-41
+        {0x8b61313bbabce2c6ULL, 0x2323ac4b3b3da015ULL},  // 5^-40
+        {0xae397d8aa96c1b77ULL, 0xabec975e0a0d081aULL},  // 5^-39
+        {0xd9c7dced53c72255ULL, 0x96e7bd358c904a21ULL},  // 5^-38
+        {0x881cea14545c7575ULL, 0x7e50d64177da2e54ULL},  // 5^-37
+        {0xaa242499697392d2ULL, 0xdde50bd1d5d0b9e9ULL},  // 5^-36
+        {0xd4ad2dbfc3d07787ULL, 0x955e4ec64b44e864ULL},  // 5^-35
+        {0x84ec3c97da624ab4ULL, 0xbd5af13bef0b113eULL},  // 5^-34
+        {0xa6274bbdd0fadd61ULL, 0xecb1ad8aeacdd58eULL},  // 5^-33
+        {0xcfb11ead453994baULL, 0x67de18eda5814af2ULL},  // 5^-32
+        {0x81ceb32c4b43fcf4ULL, 0x80eacf948770ced7ULL},  // 5^-31
+        {0xa2425ff75e14fc31ULL, 0xa1258379a94d028dULL},  // 5^-30
+        {0xcad2f7f5359a3b3eULL, 0x096ee45813a04330ULL},  // 5^-29
+        {0xfd87b5f28300ca0dULL, 0x8bca9d6e188853fcULL},  // 5^-28
+        {0x9e74d1b791e07e48ULL, 0x775ea264cf55347eULL},  // 5^-27
+        {0xc612062576589ddaULL, 0x95364afe032a819eULL},  // 5^-26
+        {0xf79687aed3eec551ULL, 0x3a83ddbd83f52205ULL},  // 5^-25
+        {0x9abe14cd44753b52ULL, 0xc4926a9672793543ULL},  // 5^-24
+        {0xc16d9a0095928a27ULL, 0x75b7053c0f178294ULL},  // 5^-23
+        {0xf1c90080baf72cb1ULL, 0x5324c68b12dd6339ULL},  // 5^-22
+        {0x971da05074da7beeULL, 0xd3f6fc16ebca5e04ULL},  // 5^-21
+        {0xbce5086492111aeaULL, 0x88f4bb1ca6bcf585ULL},  // 5^-20
+        {0xec1e4a7db69561a5ULL, 0x2b31e9e3d06c32e6ULL},  // 5^-19
+        {0x9392ee8e921d5d07ULL, 0x3aff322e62439fd0ULL},  // 5^-18
+        {0xb877aa3236a4b449ULL, 0x09befeb9fad487c3ULL},  // 5^-17
+        {0xe69594bec44de15bULL, 0x4c2ebe687989a9b4ULL},  // 5^-16
+        {0x901d7cf73ab0acd9ULL, 0x0f9d37014bf60a11ULL},  // 5^-15
+        {0xb424dc35095cd80fULL, 0x538484c19ef38c95ULL},  // 5^-14
+        {0xe12e13424bb40e13ULL, 0x2865a5f206b06fbaULL},  // 5^-13
+        {0x8cbccc096f5088cbULL, 0xf93f87b7442e45d4ULL},  // 5^-12
+        {0xafebff0bcb24aafeULL, 0xf78f69a51539d749ULL},  // 5^-11
+        {0xdbe6fecebdedd5beULL, 0xb573440e5a884d1cULL},  // 5^-10
+        {0x89705f4136b4a597ULL, 0x31680a88f8953031ULL},  // 5^-9
+        {0xabcc77118461cefcULL, 0xfdc20d2b36ba7c3eULL},  // 5^-8
+        {0xd6bf94d5e57a42bcULL, 0x3d32907604691b4dULL},  // 5^-7
+        {0x8637bd05af6c69b5ULL, 0xa63f9a49c2c1b110ULL},  // 5^-6
+        {0xa7c5ac471b478423ULL, 0x0fcf80dc33721d54ULL},  // 5^-5
+        {0xd1b71758e219652bULL, 0xd3c36113404ea4a9ULL},  // 5^-4
+        {0x83126e978d4fdf3bULL, 0x645a1cac083126eaULL},  // 5^-3
+        {0xa3d70a3d70a3d70aULL, 0x3d70a3d70a3d70a4ULL},  // 5^-2
+        {0xccccccccccccccccULL, 0xcccccccccccccccdULL},  // 5^-1
+        {0x8000000000000000ULL, 0x0000000000000000ULL},  // 5^0
+        {0xa000000000000000ULL, 0x0000000000000000ULL},  // 5^1
+        {0xc800000000000000ULL, 0x0000000000000000ULL},  // 5^2
+        {0xfa00000000000000ULL, 0x0000000000000000ULL},  // 5^3
+        {0x9c40000000000000ULL, 0x0000000000000000ULL},  // 5^4
+        {0xc350000000000000ULL, 0x0000000000000000ULL},  // 5^5
+        {0xf424000000000000ULL, 0x0000000000000000ULL},  // 5^6
+        {0x9896800000000000ULL, 0x0000000000000000ULL},  // 5^7
+        {0xbebc200000000000ULL, 0x0000000000000000ULL},  // 5^8
+        {0xee6b280000000000ULL, 0x0000000000000000ULL},  // 5^9
+        {0x9502f90000000000ULL, 0x0000000000000000ULL},  // 5^10
+        {0xba43b74000000000ULL, 0x0000000000000000ULL},  // 5^11
+        {0xe8d4a51000000000ULL, 0x0000000000000000ULL},  // 5^12
+        {0x9184e72a00000000ULL, 0x0000000000000000ULL},  // 5^13
+        {0xb5e620f480000000ULL, 0x0000000000000000ULL},  // 5^14
+        {0xe35fa931a0000000ULL, 0x0000000000000000ULL},  // 5^15
+        {0x8e1bc9bf04000000ULL, 0x0000000000000000ULL},  // 5^16
+        {0xb1a2bc2ec5000000ULL, 0x0000000000000000ULL},  // 5^17
+        {0xde0b6b3a76400000ULL, 0x0000000000000000ULL},  // 5^18
+        {0x8ac7230489e80000ULL, 0x0000000000000000ULL},  // 5^19
+        {0xad78ebc5ac620000ULL, 0x0000000000000000ULL},  // 5^20
+        {0xd8d726b7177a8000ULL, 0x0000000000000000ULL},  // 5^21
+        {0x878678326eac9000ULL, 0x0000000000000000ULL},  // 5^22
+        {0xa968163f0a57b400ULL, 0x0000000000000000ULL},  // 5^23
+        {0xd3c21bcecceda100ULL, 0x0000000000000000ULL},  // 5^24
+        {0x84595161401484a0ULL, 0x0000000000000000ULL},  // 5^25
+        {0xa56fa5b99019a5c8ULL, 0x0000000000000000ULL},  // 5^26
+        {0xcecb8f27f4200f3aULL, 0x0000000000000000ULL},  // 5^27
+        {0x813f3978f8940984ULL, 0x4000000000000000ULL},  // 5^28
+        {0xa18f07d736b90be5ULL, 0x5000000000000000ULL},  // 5^29
+        {0xc9f2c9cd04674edeULL, 0xa400000000000000ULL},  // 5^30
+        {0xfc6f7c4045812296ULL, 0x4d00000000000000ULL},  // 5^31
+        {0x9dc5ada82b70b59dULL, 0xf020000000000000ULL},  // 5^32
+        {0xc5371912364ce305ULL, 0x6c28000000000000ULL},  // 5^33
+        {0xf684df56c3e01bc6ULL, 0xc732000000000000ULL},  // 5^34
+        {0x9a130b963a6c115cULL, 0x3c7f400000000000ULL},  // 5^35
+        {0xc097ce7bc90715b3ULL, 0x4b9f100000000000ULL},  // 5^36
+        {0xf0bdc21abb48db20ULL, 0x1e86d40000000000ULL},  // 5^37
+        {0x96769950b50d88f4ULL, 0x1314448000000000ULL},  // 5^38
+        {0xbc143fa4e250eb31ULL, 0x17d955a000000000ULL},  // 5^39
+        {0xeb194f8e1ae525fdULL, 0x5dcfab0800000000ULL},  // 5^40
+        {0x92efd1b8d0cf37beULL, 0x5aa1cae500000000ULL},  // 5^41
+        {0xb7abc627050305adULL, 0xf14a3d9e40000000ULL},  // 5^42
+        {0xe596b7b0c643c719ULL, 0x6d9ccd05d0000000ULL},  // 5^43
+        {0x8f7e32ce7bea5c6fULL, 0xe4820023a2000000ULL},  // 5^44
+        {0xb35dbf821ae4f38bULL, 0xdda2802c8a800000ULL},  // 5^45
+        {0xe0352f62a19e306eULL, 0xd50b2037ad200000ULL},  // 5^46
+        {0x8c213d9da502de45ULL, 0x4526f422cc340000ULL},  // 5^47
+        {0xaf298d050e4395d6ULL, 0x9670b12b7f410000ULL},  // 5^48
+        {0xdaf3f04651d47b4cULL, 0x3c0cdd765f114000ULL},  // 5^49
+        {0x88d8762bf324cd0fULL, 0xa5880a69fb6ac800ULL},  // 5^50
+        {0xab0e93b6efee0053ULL, 0x8eea0d047a457a00ULL},  // 5^51
+        {0xd5d238a4abe98068ULL, 0x72a4904598d6d880ULL},  // 5^52
+        {0x85a36366eb71f041ULL, 0x47a6da2b7f864750ULL},  // 5^53
+        {0xa70c3c40a64e6c51ULL, 0x999090b65f67d924ULL},  // 5^54
+        {0xd0cf4b50cfe20765ULL, 0xfff4b4e3f741cf6dULL},  // 5^55
+        {0x82818f1281ed449fULL, 0xbff8f10e7a8921a4ULL},  // 5^56
+        {0xa321f2d7226895c7ULL, 0xaff72d52192b6a0dULL},  // 5^57
+        {0xcbea6f8ceb02bb39ULL, 0x9bf4f8a69f764490ULL},  // 5^58
+        {0xfee50b7025c36a08ULL, 0x02f236d04753d5b4ULL},  // 5^59
+        {0x9f4f2726179a2245ULL, 0x01d762422c946590ULL},  // 5^60
+        {0xc722f0ef9d80aad6ULL, 0x424d3ad2b7b97ef5ULL},  // 5^61
+        {0xf8ebad2b84e0d58bULL, 0xd2e0898765a7deb2ULL},  // 5^62
+        {0x9b934c3b330c8577ULL, 0x63cc55f49f88eb2fULL},  // 5^63
+        {0xc2781f49ffcfa6d5ULL, 0x3cbf6b71c76b25fbULL},  // 5^64
+        {0xf316271c7fc3908aULL, 0x8bef464e3945ef7aULL},  // 5^65
+        {0x97edd871cfda3a56ULL, 0x97758bf0e3cbb5acULL},  // 5^66
+        {0xbde94e8e43d0c8ecULL, 0x3d52eeed1cbea317ULL},  // 5^67
+        {0xed63a231d4c4fb27ULL, 0x4ca7aaa863ee4bddULL},  // 5^68
+        {0x945e455f24fb1cf8ULL, 0x8fe8caa93e74ef6aULL},  // 5^69
+        {0xb975d6b6ee39e436ULL, 0xb3e2fd538e122b44ULL},  // 5^70
+        {0xe7d34c64a9c85d44ULL, 0x60dbbca87196b616ULL},  // 5^71
+        {0x90e40fbeea1d3a4aULL, 0xbc8955e946fe31cdULL},  // 5^72
+        {0xb51d13aea4a488ddULL, 0x6babab6398bdbe41ULL},  // 5^73
+        {0xe264589a4dcdab14ULL, 0xc696963c7eed2dd1ULL},  // 5^74
+        {0x8d7eb76070a08aecULL, 0xfc1e1de5cf543ca2ULL},  // 5^75
+        {0xb0de65388cc8ada8ULL, 0x3b25a55f43294bcbULL},  // 5^76
+        {0xdd15fe86affad912ULL, 0x49ef0eb713f39ebeULL},  // 5^77
+        {0x8a2dbf142dfcc7abULL, 0x6e3569326c784337ULL},  // 5^78
+        {0xacb92ed9397bf996ULL, 0x49c2c37f07965404ULL},  // 5^79
+        {0xd7e77a8f87daf7fbULL, 0xdc33745ec97be906ULL},  // 5^80
+        {0x86f0ac99b4e8dafdULL, 0x69a028bb3ded71a3ULL},  // 5^81
+        {0xa8acd7c0222311bcULL, 0xc40832ea0d68ce0cULL},  // 5^82
+        {0xd2d80db02aabd62bULL, 0xf50a3fa490c30190ULL},  // 5^83
+        {0x83c7088e1aab65dbULL, 0x792667c6da79e0faULL},  // 5^84
+        {0xa4b8cab1a1563f52ULL, 0x577001b891185938ULL},  // 5^85
+        {0xcde6fd5e09abcf26ULL, 0xed4c0226b55e6f86ULL},  // 5^86
+        {0x80b05e5ac60b6178ULL, 0x544f8158315b05b4ULL},  // 5^87
+        {0xa0dc75f1778e39d6ULL, 0x696361ae3db1c721ULL},  // 5^88
+        {0xc913936dd571c84cULL, 0x03bc3a19cd1e38e9ULL},  // 5^89
+        {0xfb5878494ace3a5fULL, 0x04ab48a04065c723ULL},  // 5^90
+        {0x9d174b2dcec0e47bULL, 0x62eb0d64283f9c76ULL},  // 5^91
+        {0xc45d1df942711d9aULL, 0x3ba5d0bd324f8394ULL},  // 5^92
+        {0xf5746577930d6500ULL, 0xca8f44ec7ee36479ULL},  // 5^93
+        {0x9968bf6abbe85f20ULL, 0x7e998b13cf4e1ecbULL},  // 5^94
+        {0xbfc2ef456ae276e8ULL, 0x9e3fedd8c321a67eULL},  // 5^95
+        {0xefb3ab16c59b14a2ULL, 0xc5cfe94ef3ea101eULL},  // 5^96
+        {0x95d04aee3b80ece5ULL, 0xbba1f1d158724a12ULL},  // 5^97
+        {0xbb445da9ca61281fULL, 0x2a8a6e45ae8edc97ULL},  // 5^98
+        {0xea1575143cf97226ULL, 0xf52d09d71a3293bdULL},  // 5^99
+        {0x924d692ca61be758ULL, 0x593c2626705f9c56ULL},  // 5^100
+        {0xb6e0c377cfa2e12eULL, 0x6f8b2fb00c77836cULL},  // 5^101
+        {0xe498f455c38b997aULL, 0x0b6dfb9c0f956447ULL},  // 5^102
+        {0x8edf98b59a373fecULL, 0x4724bd4189bd5eacULL},  // 5^103
+        {0xb2977ee300c50fe7ULL, 0x58edec91ec2cb657ULL},  // 5^104
+        {0xdf3d5e9bc0f653e1ULL, 0x2f2967b66737e3edULL},  // 5^105
+        {0x8b865b215899f46cULL, 0xbd79e0d20082ee74ULL},  // 5^106
+        {0xae67f1e9aec07187ULL, 0xecd8590680a3aa11ULL},  // 5^107
+        {0xda01ee641a708de9ULL, 0xe80e6f4820cc9495ULL},  // 5^108
+        {0x884134fe908658b2ULL, 0x3109058d147fdcddULL},  // 5^109
+        {0xaa51823e34a7eedeULL, 0xbd4b46f0599fd415ULL},  // 5^110
+        {0xd4e5e2cdc1d1ea96ULL, 0x6c9e18ac7007c91aULL},  // 5^111
+        {0x850fadc09923329eULL, 0x03e2cf6bc604ddb0ULL},  // 5^112
+        {0xa6539930bf6bff45ULL, 0x84db8346b786151cULL},  // 5^113
+        {0xcfe87f7cef46ff16ULL, 0xe612641865679a63ULL},  // 5^114
+        {0x81f14fae158c5f6eULL, 0x4fcb7e8f3f60c07eULL},  // 5^115
+        {0xa26da3999aef7749ULL, 0xe3be5e330f38f09dULL},  // 5^116
+        {0xcb090c8001ab551cULL, 0x5cadf5bfd3072cc5ULL},  // 5^117
+        {0xfdcb4fa002162a63ULL, 0x73d9732fc7c8f7f6ULL},  // 5^118
+        {0x9e9f11c4014dda7eULL, 0x2867e7fddcdd9afaULL},  // 5^119
+        {0xc646d63501a1511dULL, 0xb281e1fd541501b8ULL},  // 5^120
+        {0xf7d88bc24209a565ULL, 0x1f225a7ca91a4226ULL},  // 5^121
+        {0x9ae757596946075fULL, 0x3375788de9b06958ULL},  // 5^122
+        {0xc1a12d2fc3978937ULL, 0x0052d6b1641c83aeULL},  // 5^123
+        {0xf209787bb47d6b84ULL, 0xc0678c5dbd23a49aULL},  // 5^124
+        {0x9745eb4d50ce6332ULL, 0xf840b7ba963646e0ULL},  // 5^125
+        {0xbd176620a501fbffULL, 0xb650e5a93bc3d898ULL},  // 5^126
+        {0xec5d3fa8ce427affULL, 0xa3e51f138ab4cebeULL},  // 5^127
+        {0x93ba47c980e98cdfULL, 0xc66f336c36b10137ULL},  // 5^128
+        {0xb8a8d9bbe123f017ULL, 0xb80b0047445d4184ULL},  // 5^129
+        {0xe6d3102ad96cec1dULL, 0xa60dc059157491e5ULL},  // 5^130
+        {0x9043ea1ac7e41392ULL, 0x87c89837ad68db2fULL},  // 5^131
+        {0xb454e4a179dd1877ULL, 0x29babe4598c311fbULL},  // 5^132
+        {0xe16a1dc9d8545e94ULL, 0xf4296dd6fef3d67aULL},  // 5^133
+        {0x8ce2529e2734bb1dULL, 0x1899e4a65f58660cULL},  // 5^134
+        {0xb01ae745b101e9e4ULL, 0x5ec05dcff72e7f8fULL},  // 5^135
+        {0xdc21a1171d42645dULL, 0x76707543f4fa1f73ULL},  // 5^136
+        {0x899504ae72497ebaULL, 0x6a06494a791c53a8ULL},  // 5^137
+        {0xabfa45da0edbde69ULL, 0x0487db9d17636892ULL},  // 5^138
+        {0xd6f8d7509292d603ULL, 0x45a9d2845d3c42b6ULL},  // 5^139
+        {0x865b86925b9bc5c2ULL, 0x0b8a2392ba45a9b2ULL},  // 5^140
+        {0xa7f26836f282b732ULL, 0x8e6cac7768d7141eULL},  // 5^141
+        {0xd1ef0244af2364ffULL, 0x3207d795430cd926ULL},  // 5^142
+        {0x8335616aed761f1fULL, 0x7f44e6bd49e807b8ULL},  // 5^143
+        {0xa402b9c5a8d3a6e7ULL, 0x5f16206c9c6209a6ULL},  // 5^144
+        {0xcd036837130890a1ULL, 0x36dba887c37a8c0fULL},  // 5^145
+        {0x802221226be55a64ULL, 0xc2494954da2c9789ULL},  // 5^146
+        {0xa02aa96b06deb0fdULL, 0xf2db9baa10b7bd6cULL},  // 5^147
+        {0xc83553c5c8965d3dULL, 0x6f92829494e5acc7ULL},  // 5^148
+        {0xfa42a8b73abbf48cULL, 0xcb772339ba1f17f9ULL},  // 5^149
+        {0x9c69a97284b578d7ULL, 0xff2a760414536efbULL},  // 5^150
+        {0xc38413cf25e2d70dULL, 0xfef5138519684abaULL},  // 5^151
+        {0xf46518c2ef5b8cd1ULL, 0x7eb258665fc25d69ULL},  // 5^152
+        {0x98bf2f79d5993802ULL, 0xef2f773ffbd97a61ULL},  // 5^153
+        {0xbeeefb584aff8603ULL, 0xaafb550ffacfd8faULL},  // 5^154
+        {0xeeaaba2e5dbf6784ULL, 0x95ba2a53f983cf38ULL},  // 5^155
+        {0x952ab45cfa97a0b2ULL, 0xdd945a747bf26183ULL},  // 5^156
+        {0xba756174393d88dfULL, 0x94f971119aeef9e4ULL},  // 5^157
+        {0xe912b9d1478ceb17ULL, 0x7a37cd5601aab85dULL},  // 5^158
+        {0x91abb422ccb812eeULL, 0xac62e055c10ab33aULL},  // 5^159
+        {0xb616a12b7fe617aaULL, 0x577b986b314d6009ULL},  // 5^160
+        {0xe39c49765fdf9d94ULL, 0xed5a7e85fda0b80bULL},  // 5^161
+        {0x8e41ade9fbebc27dULL, 0x14588f13be847307ULL},  // 5^162
+        {0xb1d219647ae6b31cULL, 0x596eb2d8ae258fc8ULL},  // 5^163
+        {0xde469fbd99a05fe3ULL, 0x6fca5f8ed9aef3bbULL},  // 5^164
+        {0x8aec23d680043beeULL, 0x25de7bb9480d5854ULL},  // 5^165
+        {0xada72ccc20054ae9ULL, 0xaf561aa79a10ae6aULL},  // 5^166
+        {0xd910f7ff28069da4ULL, 0x1b2ba1518094da04ULL},  // 5^167
+        {0x87aa9aff79042286ULL, 0x90fb44d2f05d0842ULL},  // 5^168
+        {0xa99541bf57452b28ULL, 0x353a1607ac744a53ULL},  // 5^169
+        {0xd3fa922f2d1675f2ULL, 0x42889b8997915ce8ULL},  // 5^170
+        {0x847c9b5d7c2e09b7ULL, 0x69956135febada11ULL},  // 5^171
+        {0xa59bc234db398c25ULL, 0x43fab9837e699095ULL},  // 5^172
+        {0xcf02b2c21207ef2eULL, 0x94f967e45e03f4bbULL},  // 5^173
+        {0x8161afb94b44f57dULL, 0x1d1be0eebac278f5ULL},  // 5^174
+        {0xa1ba1ba79e1632dcULL, 0x6462d92a69731732ULL},  // 5^175
+        {0xca28a291859bbf93ULL, 0x7d7b8f7503cfdcfeULL},  // 5^176
+        {0xfcb2cb35e702af78ULL, 0x5cda735244c3d43eULL},  // 5^177
+        {0x9defbf01b061adabULL, 0x3a0888136afa64a7ULL},  // 5^178
+        {0xc56baec21c7a1916ULL, 0x088aaa1845b8fdd0ULL},  // 5^179
+        {0xf6c69a72a3989f5bULL, 0x8aad549e57273d45ULL},  // 5^180
+        {0x9a3c2087a63f6399ULL, 0x36ac54e2f678864bULL},  // 5^181
+        {0xc0cb28a98fcf3c7fULL, 0x84576a1bb416a7ddULL},  // 5^182
+        {0xf0fdf2d3f3c30b9fULL, 0x656d44a2a11c51d5ULL},  // 5^183
+        {0x969eb7c47859e743ULL, 0x9f644ae5a4b1b325ULL},  // 5^184
+        {0xbc4665b596706114ULL, 0x873d5d9f0dde1feeULL},  // 5^185
+        {0xeb57ff22fc0c7959ULL, 0xa90cb506d155a7eaULL},  // 5^186
+        {0x9316ff75dd87cbd8ULL, 0x09a7f12442d588f2ULL},  // 5^187
+        {0xb7dcbf5354e9beceULL, 0x0c11ed6d538aeb2fULL},  // 5^188
+        {0xe5d3ef282a242e81ULL, 0x8f1668c8a86da5faULL},  // 5^189
+        {0x8fa475791a569d10ULL, 0xf96e017d694487bcULL},  // 5^190
+        {0xb38d92d760ec4455ULL, 0x37c981dcc395a9acULL},  // 5^191
+        {0xe070f78d3927556aULL, 0x85bbe253f47b1417ULL},  // 5^192
+        {0x8c469ab843b89562ULL, 0x93956d7478ccec8eULL},  // 5^193
+        {0xaf58416654a6babbULL, 0x387ac8d1970027b2ULL},  // 5^194
+        {0xdb2e51bfe9d0696aULL, 0x06997b05fcc0319eULL},  // 5^195
+        {0x88fcf317f22241e2ULL, 0x441fece3bdf81f03ULL},  // 5^196
+        {0xab3c2fddeeaad25aULL, 0xd527e81cad7626c3ULL},  // 5^197
+        {0xd60b3bd56a5586f1ULL, 0x8a71e223d8d3b074ULL},  // 5^198
+        {0x85c7056562757456ULL, 0xf6872d5667844e49ULL},  // 5^199
+        {0xa738c6bebb12d16cULL, 0xb428f8ac016561dbULL},  // 5^200
+        {0xd106f86e69d785c7ULL, 0xe13336d701beba52ULL},  // 5^201
+        {0x82a45b450226b39cULL, 0xecc0024661173473ULL},  // 5^202
+        {0xa34d721642b06084ULL, 0x27f002d7f95d0190ULL},  // 5^203
+        {0xcc20ce9bd35c78a5ULL, 0x31ec038df7b441f4ULL},  // 5^204
+        {0xff290242c83396ceULL, 0x7e67047175a15271ULL},  // 5^205
+        {0x9f79a169bd203e41ULL, 0x0f0062c6e984d386ULL},  // 5^206
+        {0xc75809c42c684dd1ULL, 0x52c07b78a3e60868ULL},  // 5^207
+        {0xf92e0c3537826145ULL, 0xa7709a56ccdf8a82ULL},  // 5^208
+        {0x9bbcc7a142b17ccbULL, 0x88a66076400bb691ULL},  // 5^209
+        {0xc2abf989935ddbfeULL, 0x6acff893d00ea435ULL},  // 5^210
+        {0xf356f7ebf83552feULL, 0x0583f6b8c4124d43ULL},  // 5^211
+        {0x98165af37b2153deULL, 0xc3727a337a8b704aULL},  // 5^212
+        {0xbe1bf1b059e9a8d6ULL, 0x744f18c0592e4c5cULL},  // 5^213
+        {0xeda2ee1c7064130cULL, 0x1162def06f79df73ULL},  // 5^214
+        {0x9485d4d1c63e8be7ULL, 0x8addcb5645ac2ba8ULL},  // 5^215
+        {0xb9a74a0637ce2ee1ULL, 0x6d953e2bd7173692ULL},  // 5^216
+        {0xe8111c87c5c1ba99ULL, 0xc8fa8db6ccdd0437ULL},  // 5^217
+        {0x910ab1d4db9914a0ULL, 0x1d9c9892400a22a2ULL},  // 5^218
+        {0xb54d5e4a127f59c8ULL, 0x2503beb6d00cab4bULL},  // 5^219
+        {0xe2a0b5dc971f303aULL, 0x2e44ae64840fd61dULL},  // 5^220
+        {0x8da471a9de737e24ULL, 0x5ceaecfed289e5d2ULL},  // 5^221
+        {0xb10d8e1456105dadULL, 0x7425a83e872c5f47ULL},  // 5^222
+        {0xdd50f1996b947518ULL, 0xd12f124e28f77719ULL},  // 5^223
+        {0x8a5296ffe33cc92fULL, 0x82bd6b70d99aaa6fULL},  // 5^224
+        {0xace73cbfdc0bfb7bULL, 0x636cc64d1001550bULL},  // 5^225
+        {0xd8210befd30efa5aULL, 0x3c47f7e05401aa4eULL},  // 5^226
+        {0x8714a775e3e95c78ULL, 0x65acfaec34810a71ULL},  // 5^227
+        {0xa8d9d1535ce3b396ULL, 0x7f1839a741a14d0dULL},  // 5^228
+        {0xd31045a8341ca07cULL, 0x1ede48111209a050ULL},  // 5^229
+        {0x83ea2b892091e44dULL, 0x934aed0aab460432ULL},  // 5^230
+        {0xa4e4b66b68b65d60ULL, 0xf81da84d5617853fULL},  // 5^231
+        {0xce1de40642e3f4b9ULL, 0x36251260ab9d668eULL},  // 5^232
+        {0x80d2ae83e9ce78f3ULL, 0xc1d72b7c6b426019ULL},  // 5^233
+        {0xa1075a24e4421730ULL, 0xb24cf65b8612f81fULL},  // 5^234
+        {0xc94930ae1d529cfcULL, 0xdee033f26797b627ULL},  // 5^235
+        {0xfb9b7cd9a4a7443cULL, 0x169840ef017da3b1ULL},  // 5^236
+        {0x9d412e0806e88aa5ULL, 0x8e1f289560ee864eULL},  // 5^237
+        {0xc491798a08a2ad4eULL, 0xf1a6f2bab92a27e2ULL},  // 5^238
+        {0xf5b5d7ec8acb58a2ULL, 0xae10af696774b1dbULL},  // 5^239
+        {0x9991a6f3d6bf1765ULL, 0xacca6da1e0a8ef29ULL},  // 5^240
+        {0xbff610b0cc6edd3fULL, 0x17fd090a58d32af3ULL},  // 5^241
+        {0xeff394dcff8a948eULL, 0xddfc4b4cef07f5b0ULL},  // 5^242
+        {0x95f83d0a1fb69cd9ULL, 0x4abdaf101564f98eULL},  // 5^243
+        {0xbb764c4ca7a4440fULL, 0x9d6d1ad41abe37f1ULL},  // 5^244
+        {0xea53df5fd18d5513ULL, 0x84c86189216dc5edULL},  // 5^245
+        {0x92746b9be2f8552cULL, 0x32fd3cf5b4e49bb4ULL},  // 5^246
+        {0xb7118682dbb66a77ULL, 0x3fbc8c33221dc2a1ULL},  // 5^247
+        {0xe4d5e82392a40515ULL, 0x0fabaf3feaa5334aULL},  // 5^248
+        {0x8f05b1163ba6832dULL, 0x29cb4d87f2a7400eULL},  // 5^249
+        {0xb2c71d5bca9023f8ULL, 0x743e20e9ef511012ULL},  // 5^250
+        {0xdf78e4b2bd342cf6ULL, 0x914da9246b255416ULL},  // 5^251
+        {0x8bab8eefb6409c1aULL, 0x1ad089b6c2f7548eULL},  // 5^252
+        {0xae9672aba3d0c320ULL, 0xa184ac2473b529b1ULL},  // 5^253
+        {0xda3c0f568cc4f3e8ULL, 0xc9e5d72d90a2741eULL},  // 5^254
+        {0x8865899617fb1871ULL, 0x7e2fa67c7a658892ULL},  // 5^255
+        {0xaa7eebfb9df9de8dULL, 0xddbb901b98feeab7ULL},  // 5^256
+        {0xd51ea6fa85785631ULL, 0x552a74227f3ea565ULL},  // 5^257
+        {0x8533285c936b35deULL, 0xd53a88958f87275fULL},  // 5^258
+        {0xa67ff273b8460356ULL, 0x8a892abaf368f137ULL},  // 5^259
+        {0xd01fef10a657842cULL, 0x2d2b7569b0432d85ULL},  // 5^260
+        {0x8213f56a67f6b29bULL, 0x9c3b29620e29fc73ULL},  // 5^261
+        {0xa298f2c501f45f42ULL, 0x8349f3ba91b47b8fULL},  // 5^262
+        {0xcb3f2f7642717713ULL, 0x241c70a936219a73ULL},  // 5^263
+        {0xfe0efb53d30dd4d7ULL, 0xed238cd383aa0110ULL},  // 5^264
+        {0x9ec95d1463e8a506ULL, 0xf4363804324a40aaULL},  // 5^265
+        {0xc67bb4597ce2ce48ULL, 0xb143c6053edcd0d5ULL},  // 5^266
+        {0xf81aa16fdc1b81daULL, 0xdd94b7868e94050aULL},  // 5^267
+        {0x9b10a4e5e9913128ULL, 0xca7cf2b4191c8326ULL},  // 5^268
+        {0xc1d4ce1f63f57d72ULL, 0xfd1c2f611f63a3f0ULL},  // 5^269
+        {0xf24a01a73cf2dccfULL, 0xbc633b39673c8cecULL},  // 5^270
+        {0x976e41088617ca01ULL, 0xd5be0503e085d813ULL},  // 5^271
+        {0xbd49d14aa79dbc82ULL, 0x4b2d8644d8a74e18ULL},  // 5^272
+        {0xec9c459d51852ba2ULL, 0xddf8e7d60ed1219eULL},  // 5^273
+        {0x93e1ab8252f33b45ULL, 0xcabb90e5c942b503ULL},  // 5^274
+        {0xb8da1662e7b00a17ULL, 0x3d6a751f3b936243ULL},  // 5^275
+        {0xe7109bfba19c0c9dULL, 0x0cc512670a783ad4ULL},  // 5^276
+        {0x906a617d450187e2ULL, 0x27fb2b80668b24c5ULL},  // 5^277
+        {0xb484f9dc9641e9daULL, 0xb1f9f660802dedf6ULL},  // 5^278
+        {0xe1a63853bbd26451ULL, 0x5e7873f8a0396973ULL},  // 5^279
+        {0x8d07e33455637eb2ULL, 0xdb0b487b6423e1e8ULL},  // 5^280
+        {0xb049dc016abc5e5fULL, 0x91ce1a9a3d2cda62ULL},  // 5^281
+        {0xdc5c5301c56b75f7ULL, 0x7641a140cc7810fbULL},  // 5^282
+        {0x89b9b3e11b6329baULL, 0xa9e904c87fcb0a9dULL},  // 5^283
+        {0xac2820d9623bf429ULL, 0x546345fa9fbdcd44ULL},  // 5^284
+        {0xd732290fbacaf133ULL, 0xa97c177947ad4095ULL},  // 5^285
+        {0x867f59a9d4bed6c0ULL, 0x49ed8eabcccc485dULL},  // 5^286
+        {0xa81f301449ee8c70ULL, 0x5c68f256bfff5a74ULL},  // 5^287
+        {0xd226fc195c6a2f8cULL, 0x73832eec6fff3111ULL},  // 5^288
+        {0x83585d8fd9c25db7ULL, 0xc831fd53c5ff7eabULL},  // 5^289
+        {0xa42e74f3d032f525ULL, 0xba3e7ca8b77f5e55ULL},  // 5^290
+        {0xcd3a1230c43fb26fULL, 0x28ce1bd2e55f35ebULL},  // 5^291
+        {0x80444b5e7aa7cf85ULL, 0x7980d163cf5b81b3ULL},  // 5^292
+        {0xa0555e361951c366ULL, 0xd7e105bcc332621fULL},  // 5^293
+        {0xc86ab5c39fa63440ULL, 0x8dd9472bf3fefaa7ULL},  // 5^294
+        {0xfa856334878fc150ULL, 0xb14f98f6f0feb951ULL},  // 5^295
+        {0x9c935e00d4b9d8d2ULL, 0x6ed1bf9a569f33d3ULL},  // 5^296
+        {0xc3b8358109e84f07ULL, 0x0a862f80ec4700c8ULL},  // 5^297
+        {0xf4a642e14c6262c8ULL, 0xcd27bb612758c0faULL},  // 5^298
+        {0x98e7e9cccfbd7dbdULL, 0x8038d51cb897789cULL},  // 5^299
+        {0xbf21e44003acdd2cULL, 0xe0470a63e6bd56c3ULL},  // 5^300
+        {0xeeea5d5004981478ULL, 0x1858ccfce06cac74ULL},  // 5^301
+        {0x95527a5202df0ccbULL, 0x0f37801e0c43ebc8ULL},  // 5^302
+        {0xbaa718e68396cffdULL, 0xd30560258f54e6baULL},  // 5^303
+        {0xe950df20247c83fdULL, 0x47c6b82ef32a2069ULL},  // 5^304
+        {0x91d28b7416cdd27eULL, 0x4cdc331d57fa5441ULL},  // 5^305
+        {0xb6472e511c81471dULL, 0xe0133fe4adf8e952ULL},  // 5^306
+        {0xe3d8f9e563a198e5ULL, 0x58180fddd97723a6ULL},  // 5^307
+        {0x8e679c2f5e44ff8fULL, 0x570f09eaa7ea7648ULL},  // 5^308
+    };
+
+    ///########################################################################
+    /// Decimal floating-point lexer for f32t and f64t, correctly rounded.
+    /// The field is [+-]digits[.digits][(e|E)[+-]digits] at s and s ends
+    /// past it; when d is given the field must be exactly d characters.
+    /// No digits, a field that is not d long, or a value rounding to
+    /// infinity sets e, restores s and gives 0, as in the integer lexers.
+    /// Up to 19 significant digits are summed by lexDecU64t's columns into
+    /// w, so the value is w * 10^q.  Exact cases take Clinger's path (w and
+    /// 10^|q| exact, one rounding), the rest Eisel-Lemire on decPow5.
+    /// Only when over 19 digits leave w and w + 1 rounding apart does the
+    /// C library (strtod/strtof) decide.
+    template <typename F>
+    class lexDec<F, true> : private decTable<u64t> {
+     public:
+        typedef fltLimits<F> L;
+        typedef typename L::B B;
+
+        inline F &operator()(F &v, s08pr s, u64t &e, size_t d = 0) {  // NOLINT
+            s08p o = s;
+            if (e) goto err;
+            {
+                const bool neg = (*s == '-');
+                s += (*s == '-' || *s == '+');
+                s08p i = s;
+                while (*s == '0') ++s;
+                s08p a = s;               ///< first significant digit
+                s += run(s);
+                const size_t n1 = s - a;  ///< significant integer digits
+                bool any = (s != i);
+                s08p f = s;
+                size_t n2 = 0;            ///< fraction digits
+                if (*s == '.') {
+                    f = ++s;
+                    s += run(s);
+                    n2 = s - f;
+                    any |= (n2 != 0);
+                }
+                if ((e |= !any)) goto err;
+                s64t q = -static_cast<s64t>(n2);
+                if (*s == 'e' || *s == 'E') {
+                    s08p x = s + 1;
+                    const bool minus = (*x == '-');
+                    x += (*x == '-' || *x == '+');
+                    if (static_cast<u08t>(*x - '0') < 10) {
+                        s64t n = 0;
+                        for (; static_cast<u08t>(*x - '0') < 10; ++x) {
+                            if (n < 100000) n = n * 10 + (*x - '0');
+                        }
+                        q += minus ? -n : n;
+                        s = x;
+                    }
+                }
+                if ((e |= (d && size_t(s - o) != d))) goto err;
+
+                s08p m = f;               ///< significant fraction digits
+                size_t n3 = n2;
+                if (!n1) while (n3 && *m == '0') ++m, --n3;
+                size_t k1 = n1, k3 = n3;
+                const bool cut = (n1 + n3 > 19);
+                if (cut) {
+                    k1 = n1 < 19 ? n1 : 19;
+                    k3 = 19 - k1;
+                    q += static_cast<s64t>(n1 + n3 - 19);
+                }
+                const u64t w = sum(a, k1) * decPower(k3) + sum(m, k3);
+
+                B bits;
+                if (!w || q < L::low) {
+                    bits = 0;
+                } else if (q > L::high) {
+                    e |= 1;
+                    goto err;
+                } else if (!cut && -L::fast <= q && q <= L::fast &&
+                           w <= L::wide) {
+                    v = static_cast<F>(w);
+                    v = q < 0 ? v / exact(-q) : v * exact(q);
+                    return v = neg ? -v : v;
+                } else {
+                    bits = lemire(q, w);
+                    if (cut && bits != lemire(q, w + 1)) {
+                        std::string text(o, s);
+                        v = L::strto(text.c_str());
+                        if ((e |= (v - v != 0))) goto err;  ///< infinite
+                        return v;
+                    }
+                    if ((e |= (bits >> L::M == B(L::inf)))) goto err;
+                }
+                bits |= B(neg) << (sizeof(B) * 8 - 1);
+                memcpy(&v, &bits, sizeof(v));
+                return v;
+            }
+err:        s = o;
+            return v = 0;
+        }
+
+        /// Eisel-Lemire: the top bits of w * 5^q (w normalized, a second
+        /// word of 5^q only when the first leaves the rounding bits in
+        /// doubt) give the mantissa; the binary exponent is estimated from
+        /// q.  Returns the bits of the positive result, exponent included.
+        static B lemire(s64t q, u64t w) {
+            const int lz = bitClz(w);
+            w <<= lz;
+            const u64t *p = decPow5<>::t[q + 342];
+            u64t hi, lo;
+            mul(w, p[0], hi, lo);
+            const u64t mask = ~0ULL >> (L::M + 3);
+            if ((hi & mask) == mask) {
+                u64t h2, l2;
+                mul(w, p[1], h2, l2);
+                lo += h2;
+                hi += (h2 > lo);
+            }
+            const int upper = static_cast<int>(hi >> 63);
+            const int shift = upper + 64 - L::M - 3;
+            u64t mantissa = hi >> shift;
+            s32t power2 = static_cast<s32t>(
+                    (((152170 + 65536) * static_cast<s32t>(q)) >> 16) + 63 +
+                    upper - lz - L::bias);
+            if (power2 <= 0) {           ///< subnormal or zero
+                if (-power2 + 1 >= 64) return 0;
+                mantissa >>= -power2 + 1;
+                mantissa += (mantissa & 1);
+                mantissa >>= 1;
+                power2 = mantissa < (1ULL << L::M) ? 0 : 1;
+                return B(mantissa & ((1ULL << L::M) - 1)) |
+                       (B(power2) << L::M);
+            }
+            if (lo <= 1 && q >= L::evenlo && q <= L::evenhi &&
+                    (mantissa & 3) == 1 && (mantissa << shift) == hi) {
+                mantissa &= ~1ULL;       ///< exact tie: round to even
+            }
+            mantissa += (mantissa & 1);
+            mantissa >>= 1;
+            if (mantissa >= (2ULL << L::M)) {
+                mantissa = 1ULL << L::M;
+                ++power2;
+            }
+            mantissa &= ~(1ULL << L::M);
+            if (power2 >= L::inf) return B(L::inf) << L::M;
+            return B(mantissa) | (B(power2) << L::M);
+        }
+
+#ifdef LETTVIN_LEXERS_H_CPP_UNIT
+        /// Show edge cases, then compare random fields with the C library.
+        void UnitTest(const char *name) {
+            const char * test[] = {
+                "0", "-0", "0.0", "12345.6789", "-12345.6789", ".5", "5.",
+                "+.5e-3", "1e23", "9007199254740993", "0.1",
+                "3.4028234663852886e38", "3.4028235677973366e38",
+                "1.7976931348623157e308", "1.7976931348623159e308",
+                "2.2250738585072014e-308", "4.9406564584124654e-324",
+                "2.4703282292062327e-324", "2.4703282292062328e-324",
+                "1.00000005960464477539062499", "123456789012345678901234",
+                "1e", "1e+", "1x", ".", "-", "e5", "",
+                0L
+            };
+            std::cout << "lexDec<" << name << ">" << std::endl;
+            for (size_t i = 0; test[i]; ++i) {
+                char buffer[64];
+                strcpy(buffer, test[i]);  // NOLINT
+                char *t = buffer;
+                u64t error = 0;
+                F v = 7;
+                (*this)(v, t, error);
+                std::cout <<
+                    std::setw(30) << test[i] << " " <<
+                    std::setw(24) << std::setprecision(17) << v << " " <<
+                    std::setw(2) << (t - buffer) << " " <<
+                    error << std::endl;
+            }
+
+            size_t cases = 0, mismatches = 0;
+            u64t x = 20160518ULL;   ///< LCG state
+            for (size_t k = 0; k < 20000; ++k) {
+                char buffer[64];
+                size_t n = 0;
+                x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+                if ((x >> 61) == 0) buffer[n++] = '-';
+                const size_t digits = 1 + (x >> 33) % (k % 3 ? 19 : 30);
+                const size_t point = (x >> 20) % (digits + 2);
+                for (size_t j = 0; j < digits; ++j) {
+                    if (j == point) buffer[n++] = '.';
+                    x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+                    buffer[n++] = static_cast<char>('0' + (x >> 33) % 10);
+                }
+                if ((x >> 40) % 4) {
+                    const int span = 2 * (L::high - L::low) / 3;
+                    n += snprintf(buffer + n, 16, "e%d",
+                            static_cast<int>((x >> 8) % span) - span / 2);
+                }
+                buffer[n] = 0;
+                char *end;
+                const F want = sizeof(F) == 8 ? strtod(buffer, &end) :
+                    strtof(buffer, &end);
+                const bool werr = (want - want != 0);
+                char *g = buffer;
+                u64t gerr = 0;
+                F got = 7;
+                (*this)(got, g, gerr);
+                mismatches += werr ? (!gerr || g != buffer) :
+                    (gerr || g != end || memcmp(&got, &want, sizeof(F)));
+                ++cases;
+            }
+            std::cout << "lexDec<" << name << ">: " << cases << " cases " <<
+                mismatches << " mismatches" << std::endl;
+        }
+#endif
+
+     private:
+        /// Sum n digits at p through the column tables lexDecU64t uses;
+        /// the n lookups are independent so they overlap.
+        static inline u64t sum(const char *p, size_t n) {
+            u64t w = 0;
+            for (const u08t *c = reinterpret_cast<const u08t *>(p); n; ++c) {
+                w += col[--n][*c];
+            }
+            return w;
+        }
+
+        /// Count the ASCII digits at s.
+        static inline size_t run(const char *s) {
+            const char *p = s;
+            while (static_cast<u08t>(*p - '0') < 10) ++p;
+            return p - s;
+        }
+
+        /// 10^n for n <= fast, exactly representable in F; the halves are
+        /// exact too, so their product is.
+        static inline F exact(s64t n) {
+            const size_t h = static_cast<size_t>(n) / 2;
+            return static_cast<F>(decPower(h)) *
+                static_cast<F>(decPower(static_cast<size_t>(n) - h));
+        }
+
+        /// Full 64 x 64 -> 128 bit product.
+        static inline void mul(u64t a, u64t b, u64r hi, u64r lo) {
+#if defined(__SIZEOF_INT128__) && defined(__GNUC__)
+            const u128t p = static_cast<u128t>(a) * b;
+            hi = static_cast<u64t>(p >> 64);
+            lo = static_cast<u64t>(p);
+#else
+            const u64t a0 = a & 0xFFFFFFFF, a1 = a >> 32;
+            const u64t b0 = b & 0xFFFFFFFF, b1 = b >> 32;
+            const u64t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0;
+            const u64t mid = (p00 >> 32) + (p01 & 0xFFFFFFFF) +
+                (p10 & 0xFFFFFFFF);
+            lo = (mid << 32) | (p00 & 0xFFFFFFFF);
+            hi = a1 * b1 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+#endif
+        }
+    };
+
+    typedef lexDec<f32t> lexDecF32t;
+    typedef lexDec<f64t> lexDecF64t;
+
+    static lexDecF32t lexDecF32_Instance;
+    static lexDecF64t lexDecF64_Instance;
+
+    ///########################################################################
+    /// Fixed-point lexer: "12345.6789" at scale k into the s64t 123456789
+    /// (k = 4), as exact integers for prices, with no floating point.
+    /// Integer digit j (of i) lands in column k + i - 1 - j and fraction
+    /// digit j in column k - 1 - j of the decTable<s64t> tables, so both
+    /// halves are summed in one pass with lexDec's overflow test against
+    /// top (-9223372036854775808 is reachable only with a '-').
+    /// The strict inv rows flag a non-digit among the counted digits.
+    /// Fewer than k fraction digits are scaled up; more are an error, as
+    /// are i + k > 19, no digits at all, and values outside [lo, hi].
+    /// On error s is restored and v is 0.
+    class lexFixS64t : private decTable<s64t, true> {
+     public:
+        static const size_t D = decLimits<s64t>::D;
+
+        /// Counted form: i integer digits, then '.' and f fraction digits
+        /// when f is non-zero.  The sign, if any, precedes the i digits.
+        inline s64t &operator()(
+                s64t &v,                                            // NOLINT
+                s08pr s,
+                u64t &e,                                            // NOLINT
+                size_t k,
+                size_t i,
+                size_t f,
+                s64t hi = std::numeric_limits<s64t>::max(),
+                s64t lo = std::numeric_limits<s64t>::min()) {
+            s08p o = s;
+            const bool neg = (*s == '-');
+            s += (*s == '-' || *s == '+');
+            u64t m = 0, r = decLimits<s64t>::top - !neg;
+            if ((e |= (i + k > D) || (f > k) || !(i + f))) goto err;
+            for (size_t n = k + i; n-- > k; ) column(n, m, s, e, r);
+            if (f && !(e |= (*s != '.'))) {
+                ++s;
+                for (size_t n = k; n-- > k - f; ) column(n, m, s, e, r);
+            }
+            return finish(v, s, e, o, m, neg, hi, lo);
+err:        s = o;
+            return v = 0;
+        }
+
+        /// Self-delimiting form: finds the integer digits and the '.'
+        /// itself; the fraction ends at its first non-digit.
+        inline s64t &delimited(
+                s64t &v,                                            // NOLINT
+                s08pr s,
+                u64t &e,                                            // NOLINT
+                size_t k,
+                s64t hi = std::numeric_limits<s64t>::max(),
+                s64t lo = std::numeric_limits<s64t>::min()) {
+            s08p o = s;
+            const bool neg = (*s == '-');
+            s += (*s == '-' || *s == '+');
+            const size_t i = lexDecU64t::span(s);
+            u64t m = 0, r = decLimits<s64t>::top - !neg;
+            if ((e |= (i + k > D))) goto err;
+            for (size_t n = k + i; n-- > k; ) column(n, m, s, e, r);
+            if (*s == '.' && !e) {
+                s08p f = ++s;
+                for (size_t n = k; n-- && digit(*s); ) column(n, m, s, e, r);
+                e |= digit(*s);       ///< more than k fraction digits
+                e |= !(i + (s - f));  ///< "." alone
+            } else {
+                e |= !i;
+            }
+            return finish(v, s, e, o, m, neg, hi, lo);
+err:        s = o;
+            return v = 0;
+        }
+
+#ifdef LETTVIN_LEXERS_H_CPP_UNIT
+        /// Show edge cases of both forms, then compare random prices
+        /// against lexDec<s64t> on the same digits with the point removed.
+        void UnitTest() {
+            std::cout << "lexFixS64t" << std::endl;
+            UnitTest("12345.6789", 4, 5, 4);
+            UnitTest("12345.67", 4, 5, 2);
+            UnitTest("-12345.6789", 4, 5, 4);
+            UnitTest("12345", 4, 5, 0);
+            UnitTest(".6789", 4, 0, 4);
+            UnitTest("12345.67891", 4, 5, 5);
+            UnitTest("12345,6789", 4, 5, 4);
+            UnitTest("12a45.6789", 4, 5, 4);
+            UnitTest("1 345.6789", 4, 5, 4);
+            UnitTest("12345.67x9", 4, 5, 4);
+            UnitTest("922337203685477.5807", 4, 15, 4);
+            UnitTest("922337203685477.5808", 4, 15, 4);
+            UnitTest("-922337203685477.5808", 4, 15, 4);
+            UnitTest("-922337203685477.5809", 4, 15, 4);
+            UnitTest("9223372036854775807", 0, 19, 0);
+            UnitTest("1.0", 18, 1, 1);
+            UnitTest("10.0", 18, 2, 1);
+            UnitTest("12345.6789", 4);
+            UnitTest("-0.5,", 4);
+            UnitTest("+7.", 2);
+            UnitTest("7.125x", 2);
+            UnitTest(".", 2);
+            UnitTest("-", 2);
+            UnitTest("42;", 0);
+            UnitTest("-922337203685477.5808", 4);
+            UnitTest("922337203685477.5808", 4);
+            UnitTestExample();
+
+            size_t cases = 0, mismatches = 0;
+            u64t x = 20160520ULL;   ///< LCG state
+            for (size_t c = 0; c < 6000; ++c) {
+                char buffer[48], plain[48];
+                size_t n = 0, p = 0;
+                x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+                const size_t k = (x >> 33) % 10;
+                const size_t i = (x >> 37) % (D + 1 - k);
+                const size_t f = (x >> 43) % (k + 2);
+                const bool minus = (x >> 50) % 3 == 0;
+                const bool junk = (x >> 56) % 8 == 0;   ///< one non-digit
+                const size_t at = (x >> 20) % (i + f + 1);
+                if (minus) buffer[n++] = plain[p++] = '-';
+                for (size_t j = 0; j < i + f; ++j) {
+                    x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+                    const char digit = static_cast<char>(
+                        junk && j == at ? " a/:x"[(x >> 33) % 5] :
+                        (x >> 50) % 16 ? '0' + (x >> 33) % 10 : '9');
+                    if (j == i) buffer[n++] = '.';
+                    buffer[n++] = plain[p++] = digit;
+                }
+                for (size_t j = f; j < k; ++j) plain[p++] = '0';
+                buffer[n] = plain[p] = 0;
+                s64t want = 0;
+                u64t werr = !(i + f) || f > k || p - minus > D;
+                char *w = plain;
+                if (!werr) lexDecS64_Instance(want, w, werr, p);
+
+                s64t got = 7;
+                u64t gerr = 0;
+                char *g = buffer;
+                (*this)(got, g, gerr, k, i, f);
+                mismatches += got != want || gerr != werr ||
+                    g != buffer + (werr ? 0 : n);
+                ++cases;
+                if (junk && at < i + f) continue;  ///< ends the field early
+                got = 7, gerr = 0, g = buffer;
+                delimited(got, g, gerr, k);
+                mismatches += got != want || gerr != werr ||
+                    g != buffer + (werr ? 0 : n);
+                ++cases;
+            }
+            std::cout << "lexFixS64t: " << cases << " cases " <<
+                mismatches << " mismatches" << std::endl;
+        }
+
+        /// The header's example as written there, minus the namespace.
+        void UnitTestExample() {
+            lexFixS64t &lexFixS64_Instance = *this;
+            char source[ ] = "12345.67,";
+            char *s = source;
+            long long ticks;   // 1234567000 at scale 10^5
+            u64t error = 0;
+
+            ticks = lexFixS64_Instance.delimited( ticks, s, error, 5 );
+            std::cout << "example " << ticks << " " << (s - source);
+            s = source;
+            ticks = lexFixS64_Instance( ticks, s, error, 5, 5, 2 );
+            std::cout << " " << ticks << " " << (s - source) << " " <<
+                error << std::endl;
+        }
+
+        void UnitTest(const char *in, size_t k, size_t i, size_t f) {
+            show(in, k, i, f, true);
+        }
+        void UnitTest(const char *in, size_t k) { show(in, k, 0, 0, false); }
+
+        void show(const char *in, size_t k, size_t i, size_t f, bool c) {
+            char buffer[32];
+            strcpy(buffer, in);  // NOLINT
+            char *t = buffer;
+            u64t error = 0;
+            s64t v = 7;
+            if (c) (*this)(v, t, error, k, i, f);
+            else   delimited(v, t, error, k);
+            std::cout <<
+                std::setw(22) << in << " k" << std::setw(2) << k;
+            if (c) std::cout << " i" << std::setw(2) << i << " f" << f;
+            else   std::cout << "      ";
+            std::cout <<
+                std::setw(21) << v << " " <<
+                std::setw(2) << (t - buffer) << " " <<
+                error << std::endl;
+        }
+#endif
+
+     private:
+        static inline bool digit(char c) {
+            return static_cast<u08t>(c - '0') < 10;
+        }
+
+        inline void column(size_t n, u64r m, s08pr s, u64r e, u64r r) {
+            u64t t;
+            e ||
+            (e |= this->inv[n][static_cast<u08t>(*s)]) ||
+            (e |= ((t = this->col[n][static_cast<u08t>(*s)]) > r)) ||
+            ((r -= t), (m += t), (++s));
+        }
+
+        static inline s64t &finish(
+                s64t &v, s08pr s, u64t &e, s08p o,                  // NOLINT
+                u64t m, bool neg, s64t hi, s64t lo) {
+            v = neg && m ? s64t(-s64t(m - 1) - 1) : s64t(m);
+            e |= (v < lo) || (v > hi);
+            if (!e) return v;
+            s = o;
+            return v = 0;
+        }
+    };
+
+    static lexFixS64t lexFixS64_Instance;
+
+    ///########################################################################
+    /// Byte masks of lexTimeU64t, statics of a class template as in
+    /// decPairs<> so that every translation unit including this header
+    /// shares one definition.  layout: separators where they belong, 0 at
+    /// digits, padded to 32 bytes for the second load.  tail: 17 zero
+    /// bytes then 16 of 0xFF, so a load at tail + 1 + n keeps the last n
+    /// bytes of a register, none at tail.
+    template <typename T = void> struct timeMasks {
+        static constexpr char layout[32] = {
+            0, 0, 0, 0, 0, 0, 0, 0, '-', 0, 0, ':', 0, 0, ':', 0,
+            0, '.', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+        static constexpr char tail[33] = {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+            '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff' };
+    };
+
+    template <typename T> constexpr char timeMasks<T>::layout[32];
+    template <typename T> constexpr char timeMasks<T>::tail[33];
+
+    ///########################################################################
+    /// UTC timestamp lexer: "YYYYMMDD-HH:MM:SS" with ".nnn", ".nnnnnn" or
+    /// ".nnnnnnnnn" (d = 17, 21, 24, 27) into u64t nanoseconds since
+    /// 1970-01-01, with no libc call.  Digits are summed through the
+    /// decTable<u64t> columns and the date becomes a day count
+    /// arithmetically (days from civil, 400 year eras).  Every byte must
+    /// be a digit or the separator of the layout, and each field in range:
+    /// year from 1970, month 01-12, day within the month (leap years
+    /// included), hour 00-23, minute 00-59 and second 00-60; a leap
+    /// second 60 is the next minute's 00, as timegm() has it.  Results
+    /// past 2554-07-21-23:34:33.709551615 overflow.  The contract is
+    /// lexDecU64t's: (v, s, e, d, r, b), nothing done once e is set, d == 0
+    /// yields 0, and on error e |= 1, s is restored and v is 0.
+    /// When lexDecU64t's CPUID check found SSE4.1 the layout is checked
+    /// with two 16 byte loads inside the field and the fields are summed
+    /// in one multiply-add.
+    class lexTimeU64t : private decTable<u64t>, private timeMasks<> {
+     public:
+        static const size_t D = 27;
+
+        inline u64t &operator()(
+                u64r v,
+                s08pr s,
+                u64t &e,                                            // NOLINT
+                size_t d = D,
+                u64t r = ~0ULL,
+                u64t b = 0) {
+#if LETTVIN_LEXDEC_SIMD
+            if (lexDecU64t::kernel && d >= 17) return vector(v, s, e, d, r, b);
+#endif
+            return scalar(v, s, e, d, r, b);
+        }
+
+        /// The table engine, also the reference for vector().
+        static u64t &scalar(
+                u64r v, s08pr s, u64t &e,                           // NOLINT
+                size_t d, u64t r, u64t b) {
+            if (e || !d) return v = 0;
+            if ((e |= !scale(d))) return v = 0;
+            for (size_t i = 0; i < d; ++i) {
+                const u08t c = static_cast<u08t>(s[i]);
+                if ((e |= layout[i] ? c != u08t(layout[i]) : c - 48U > 9)) {
+                    return v = 0;
+                }
+            }
+            const u64t f = d > 18 ? sum(s + 18, d - 18) : 0;
+            return stamp(v, s, e, d, r, b, sum(s, 4), sum(s + 4, 2),
+                    sum(s + 6, 2), sum(s + 9, 2), sum(s + 12, 2),
+                    sum(s + 15, 2), f * scale(d));
+        }
+
+#if LETTVIN_LEXDEC_SIMD
+        /// Check every byte against the layout with one compare for the
+        /// digits and one for the separators per load, gather the date and
+        /// time digits into pairs for one multiply-add, and sum the
+        /// fraction, right-aligned in the second load, as lexDecU64t does.
+        __attribute__((target("sse4.1")))
+        static u64t &vector(
+                u64r v, s08pr s, u64t &e,                           // NOLINT
+                size_t d, u64t r, u64t b) {
+            if (e || !d) return v = 0;
+            if ((e |= !scale(d))) return v = 0;
+            const __m128i nine = _mm_set1_epi8(9), zero = _mm_set1_epi8('0');
+            const size_t p = d - 16;     ///< column of the second load
+            const __m128i x = load(s), y = load(s + p);
+            const __m128i u = _mm_sub_epi8(x, zero), w = _mm_sub_epi8(y, zero);
+            const u32t digit = u32t(_mm_movemask_epi8(
+                    _mm_cmpeq_epi8(_mm_max_epu8(u, nine), nine))) |
+                u32t(_mm_movemask_epi8(
+                    _mm_cmpeq_epi8(_mm_max_epu8(w, nine), nine))) << p;
+            const u32t sep = u32t(_mm_movemask_epi8(
+                    _mm_cmpeq_epi8(x, load(layout)))) |
+                u32t(_mm_movemask_epi8(
+                    _mm_cmpeq_epi8(y, load(layout + p)))) << p;
+            const u32t all = (1U << d) - 1;
+            if ((e |= ((digit & digits) | (sep & ~digits)) != all)) {
+                return v = 0;
+            }
+            /// YY YY MM DD hh mm ss from s + 1, the first Y put back.
+            __m128i t = _mm_shuffle_epi8(_mm_sub_epi8(load(s + 1), zero),
+                    _mm_setr_epi8(-1, 0, 1, 2, 3, 4, 5, 6,
+                                  8, 9, 11, 12, 14, 15, -1, -1));
+            t = _mm_insert_epi8(t, s[0] - '0', 0);
+            t = _mm_maddubs_epi16(t, _mm_set1_epi16(0x010A));
+            /// At most 9 fraction digits: groups of 4 in lanes 1..3.
+            __m128i f = _mm_maddubs_epi16(_mm_and_si128(w,
+                        load(tail + d - 17)), _mm_set1_epi16(0x010A));
+            f = _mm_madd_epi16(f, _mm_set1_epi32(0x00010064));
+            return stamp(v, s, e, d, r, b,
+                    u64t(_mm_extract_epi16(t, 0)) * 100 +
+                    u64t(_mm_extract_epi16(t, 1)),
+                    u64t(_mm_extract_epi16(t, 2)),
+                    u64t(_mm_extract_epi16(t, 3)),
+                    u64t(_mm_extract_epi16(t, 4)),
+                    u64t(_mm_extract_epi16(t, 5)),
+                    u64t(_mm_extract_epi16(t, 6)), scale(d) *
+                    (u64t(_mm_extract_epi32(f, 1)) * 100000000 +
+                     u64t(_mm_extract_epi32(f, 2)) * 10000 +
+                     u64t(_mm_extract_epi32(f, 3))));
+        }
+#endif
+
+#ifdef LETTVIN_LEXERS_H_CPP_UNIT
+        /// Show edge cases, then compare random valid and damaged stamps
+        /// of every length with timegm() through both engines.
+        void UnitTest() {
+            std::cout << "lexTimeU64t " << D << " bytes" << std::endl;
+            const char *test[] = {
+                "19700101-00:00:00", "19700101-00:00:00.000000001",
+                "20000229-12:34:56.789", "20240229-23:59:59.999999",
+                "21000229-00:00:00", "20230431-00:00:00", "20231301-00:00:00",
+                "20230100-00:00:00", "20230101-24:00:00", "20230101-23:60:00",
+                "20161231-23:59:60", "20161231-23:59:61", "19691231-23:59:59",
+                "25540721-23:34:33.709551615", "25540721-23:34:33.709551616",
+                "20230101 00:00:00", "2023010a-00:00:00", "20230101-00:00:00.",
+                "20230101-00:00:00.1234"
+            };
+            for (size_t i = 0; i < sizeof(test) / sizeof(*test); ++i) {
+                UnitTest(test[i], strlen(test[i]));
+            }
+            UnitTest("20230101-00:00:00.123", 0);
+            UnitTest("20230101-00:00:00.123", 21, 1672531200123000000ULL,
+                    1672531200123000000ULL);
+            UnitTest("20230101-00:00:00.123", 21, 1672531200122999999ULL);
+
+            size_t cases = 0, mismatches = 0;
+            u64t x = 20180712ULL;   ///< LCG state
+            const size_t lengths[] = { 17, 21, 24, 27 };
+            for (size_t k = 0; k < 20000; ++k) {
+                char buffer[48];
+                x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+                const size_t d = lengths[(x >> 60) % 4];
+                struct tm when;
+                memset(&when, 0, sizeof(when));
+                when.tm_year = 70 + static_cast<int>((x >> 20) % 600);
+                when.tm_mon = static_cast<int>((x >> 30) % 12);
+                when.tm_mday = 1 + static_cast<int>((x >> 34) % 31);
+                when.tm_hour = static_cast<int>((x >> 39) % 24);
+                when.tm_min = static_cast<int>((x >> 44) % 60);
+                when.tm_sec = static_cast<int>((x >> 50) % 61);
+                const u64t nanos = (x >> 1) % 1000000000ULL;
+                snprintf(buffer, sizeof(buffer),
+                        "%04d%02d%02d-%02d:%02d:%02d.%09llu",
+                        when.tm_year + 1900, when.tm_mon + 1, when.tm_mday,
+                        when.tm_hour, when.tm_min, when.tm_sec,
+                        static_cast<unsigned long long>(nanos));
+                /// Flipping 0x10 turns any digit or separator into a byte
+                /// the layout refuses.
+                const bool damaged = (x >> 56) % 8 == 0;
+                if (damaged) buffer[(x >> 8) % d] ^= 0x10;
+                const u64t frac = d > 18 ? nanos / scale(d) * scale(d) : 0;
+                struct tm copy = when, probe = when;
+                const time_t t = timegm(&copy);
+                probe.tm_sec = 0;   ///< a leap second may roll the day
+                timegm(&probe);
+                u64t want = 0, werr = damaged ||
+                    probe.tm_mday != when.tm_mday;
+                if (!werr && (u64t(t) > 18446744073ULL ||
+                        (u64t(t) == 18446744073ULL && frac > 709551615ULL))) {
+                    werr = 1;
+                }
+                if (!werr) want = u64t(t) * 1000000000ULL + frac;
+                for (int engine = 0; engine < 2; ++engine, ++cases) {
+                    u64t got = 7, gerr = 0;
+                    char *g = buffer;
+                    if (engine) (*this)(got, g, gerr, d);
+                    else        scalar(got, g, gerr, d, ~0ULL, 0);
+                    mismatches += got != want || gerr != werr ||
+                        g != buffer + (werr ? 0 : d);
+                }
+            }
+            std::cout << "lexTimeU64t: " << cases << " cases " <<
+                mismatches << " mismatches" << std::endl;
+        }
+
+        void UnitTest(const char *in, size_t d, u64t hi = ~0ULL,
+                u64t lo = 0) {
+            char buffer[32];
+            strcpy(buffer, in);  // NOLINT
+            char *t = buffer, *u = buffer;
+            u64t error = 0, check = 0, v = 7, w = 7;
+            (*this)(v, t, error, d, hi, lo);
+            scalar(w, u, check, d, hi, lo);
+            std::cout <<
+                std::setw(28) << in <<
+                std::setw(21) << v << " " <<
+                std::setw(2) << (t - buffer) << " " <<
+                error << (v != w || t != u || error != check ? " !" : "") <<
+                std::endl;
+        }
+
+#endif
+
+     private:
+        /// The digit bytes of the layout.
+        static const u32t digits = 0x07FFFFFF & ~(1U << 8 | 1U << 11 |
+                1U << 14 | 1U << 17);
+
+        /// 10^(27 - d) for the lengths with a layout, else 0.
+        static inline u64t scale(size_t d) {
+            return d == 27 ? 1 : d == 24 ? 1000 : d == 21 ? 1000000 :
+                d == 17 ? 1 : 0;
+        }
+
+        /// Sum n <= 9 digits at p through the columns.
+        static inline u64t sum(const char *p, size_t n) {
+            u64t w = 0;
+            for (const u08t *c = reinterpret_cast<const u08t *>(p); n; ++c) {
+                w += col[--n][*c];
+            }
+            return w;
+        }
+
+#if LETTVIN_LEXDEC_SIMD
+        __attribute__((target("sse4.1")))
+        static inline __m128i load(const char *p) {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        }
+#endif
+
+        /// Range-check the fields, count days from 1970-01-01 and combine.
+        static inline u64t &stamp(
+                u64r v, s08pr s, u64t &e,                           // NOLINT
+                size_t d, u64t r, u64t b, u64t year, u64t month, u64t day,
+                u64t hour, u64t minute, u64t second, u64t nanos) {
+            static const u08t month_days[13] = {
+                0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+            const bool leap = year % 4 == 0 &&
+                (year % 100 != 0 || year % 400 == 0);
+            if ((e |= year < 1970 || month - 1 > 11 || day - 1 >=
+                        u64t(month_days[month] + (leap && month == 2)) ||
+                        hour > 23 || minute > 59 || second > 60)) {
+                return v = 0;
+            }
+            const u64t y = year - (month <= 2);
+            const u64t era = y / 400, yoe = y - era * 400;
+            const u64t doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) /
+                5 + day - 1;
+            const u64t days = era * 146097 + yoe * 365 + yoe / 4 - yoe / 100 +
+                doy - 719468;
+            const u64t seconds = days * 86400 + hour * 3600 + minute * 60 +
+                second;
+            if ((e |= seconds > top / billion ||
+                        seconds * billion > top - nanos)) {
+                return v = 0;
+            }
+            const u64t t = seconds * billion + nanos;
+            if ((e |= t > r || t < b)) return v = 0;
+            s += d;
+            return v = t;
+        }
+
+        static const u64t billion = 1000000000ULL;
+    };
+
+    static lexTimeU64t lexTimeU64_Instance;
+
+    ///########################################################################
+    /// u64t lexer in base B with the lexDecU64t contract and columns:
+    /// (ull, s, e, d, r, b), no lexing once e is set, overflow found in the
+    /// column it happens against the remaining r, s advanced only on
+    /// success and restored with ull = 0 on failure.  d runs to D, the
+    /// most base B digits a u64t has (16 hex, 13 base 36).
+    /// Hex fields of 8 to 16 digits are decoded 16 nibbles at a time when
+    /// lexDecU64t's CPUID check found SSE4.1 and the load stays in a page.
+    template <u64t B>
+    class lexRadU64t : private radTable<B> {
+     public:
+        static const size_t D = radLimits<B>::D;
+
+        inline u64t &operator()(
+                u64r ull,
+                s08pr s,
+                u64t &e,                                            // NOLINT
+                size_t d = D,
+                u64t r = radLimits<B>::top,
+                u64t b = 0) {
+            s08p o = s;
+            if ((e |= (d > D))) goto err;
+#if LETTVIN_LEXDEC_SIMD
+            if (B == 16 && d >= 8 && d <= 16 && lexDecU64t::kernel &&
+                    lexDecU64t::paged(s))
+                return nibbles(ull, s, e, d, r, b);
+#endif
+            ull = 0;
+            switch (d) {
+#define RADU64CASE(n) \
+            case n + 1: if (n < D) column<(n < D ? n : 0)>(ull, s, e, r)
+            RADU64CASE(15); LETTVIN_FALLTHROUGH;
+            RADU64CASE(14); LETTVIN_FALLTHROUGH;
+            RADU64CASE(13); LETTVIN_FALLTHROUGH;
+            RADU64CASE(12); LETTVIN_FALLTHROUGH;
+            RADU64CASE(11); LETTVIN_FALLTHROUGH;
+            RADU64CASE(10); LETTVIN_FALLTHROUGH;
+            RADU64CASE(9); LETTVIN_FALLTHROUGH;
+            RADU64CASE(8); LETTVIN_FALLTHROUGH;
+            RADU64CASE(7); LETTVIN_FALLTHROUGH;
+            RADU64CASE(6); LETTVIN_FALLTHROUGH;
+            RADU64CASE(5); LETTVIN_FALLTHROUGH;
+            RADU64CASE(4); LETTVIN_FALLTHROUGH;
+            RADU64CASE(3); LETTVIN_FALLTHROUGH;
+            RADU64CASE(2); LETTVIN_FALLTHROUGH;
+            RADU64CASE(1); LETTVIN_FALLTHROUGH;
+            RADU64CASE(0);
+                break;
+            default: goto err;        ///< d == 0 as in lexDecU64t
+            }
+            e |= (ull < b);
+            if (!e) return ull;
+err:        s = o;
+            return ull = 0;
+        }
+
+#if LETTVIN_LEXDEC_SIMD
+        /// Decode 16 bytes to nibbles, 0x80 marking a non-hex byte, move
+        /// the d field bytes to the right (zeros enter at the left), then
+        /// pair nibbles into bytes with one multiply-add and byte swap.
+        __attribute__((target("sse4.1"), no_sanitize_address))
+        static u64t &nibbles(
+                u64r ull, s08pr s, u64t &e,                         // NOLINT
+                size_t d, u64t r, u64t b) {
+            const __m128i x = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i *>(s));
+            const __m128i n = _mm_sub_epi8(x, _mm_set1_epi8('0'));
+            const __m128i a = _mm_sub_epi8(
+                    _mm_or_si128(x, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+            const __m128i isn = _mm_cmpeq_epi8(
+                    _mm_max_epu8(n, _mm_set1_epi8(9)), _mm_set1_epi8(9));
+            const __m128i isa = _mm_cmpeq_epi8(
+                    _mm_max_epu8(a, _mm_set1_epi8(5)), _mm_set1_epi8(5));
+            __m128i v = _mm_or_si128(_mm_and_si128(n, isn),
+                    _mm_and_si128(_mm_add_epi8(a, _mm_set1_epi8(10)), isa));
+            v = _mm_or_si128(v, _mm_andnot_si128(_mm_or_si128(isn, isa),
+                    _mm_set1_epi8(static_cast<char>(0x80))));
+            v = _mm_shuffle_epi8(v, _mm_add_epi8(
+                    _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7,
+                                  8, 9, 10, 11, 12, 13, 14, 15),
+                    _mm_set1_epi8(static_cast<char>(d - 16))));
+            const bool bad = _mm_movemask_epi8(v) != 0;
+            v = _mm_maddubs_epi16(v, _mm_set1_epi16(0x0110));
+            v = _mm_packus_epi16(v, v);
+            const u64t w = __builtin_bswap64(
+                    static_cast<u64t>(_mm_cvtsi128_si64(v)));
+            if (bad || w > r || w < b) {
+                e |= 1;
+                return ull = 0;
+            }
+            s += d;
+            return ull = w;
+        }
+#endif
+
+#ifdef LETTVIN_LEXERS_H_CPP_UNIT
+        /// Show edge cases, then compare random fields, some with a byte
+        /// outside base B, with strtoull.
+        void UnitTest(const char *name) {
+            std::cout << name << " " << D << " digits" << std::endl;
+            const char *test[] = {
+                "0", "7", "a", "Z", "z", "ff", "FF", "fF00", "0x1f", "-1",
+                "ffffffffffffffff", "10000000000000000", "3w5e11264sgsf",
+                "3w5e11264sgsg", "3W5E11264SGSF", "4000000000000",
+                "deadbeefcafef00d", "0000000000000001", "12 4", "g",
+                0L
+            };
+            for (size_t i = 0; test[i]; ++i) {
+                UnitTest(test[i], strlen(test[i]));
+            }
+            UnitTest("ff", 2, 0xfe);
+            UnitTest("ff", 2, 0xff, 0xff);
+
+            size_t cases = 0, mismatches = 0;
+            u64t x = 20160521ULL;   ///< LCG state
+            for (size_t k = 0; k < 6000; ++k) {
+                char buffer[32];
+                x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+                const size_t d = 1 + (x >> 33) % (D + 1);
+                const char *alpha = "0123456789abcdefghijklmnopqrstuvwxyz";
+                for (size_t i = 0; i < d; ++i) {
+                    x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+                    buffer[i] = (x >> 40) % 2 && i < d / 2 ? alpha[B - 1] :
+                        static_cast<char>(((x >> 60) & 1 ? toupper : tolower)(
+                            alpha[(x >> 33) % B]));
+                }
+                if ((x >> 50) % 8 == 0) {
+                    buffer[(x >> 20) % d] = ".:/@_"[(x >> 24) % 5];
+                }
+                buffer[d] = ' ';
+                buffer[d + 1] = 0;
+                errno = 0;
+                char *end;
+                u64t want = strtoull(buffer, &end, B);
+                const bool werr = d > D || end != buffer + d || errno;
+                if (werr) want = 0;
+                char *g = buffer;
+                u64t got = 7, gerr = 0;
+                (*this)(got, g, gerr, d);
+                mismatches += got != want || gerr != werr ||
+                    g != buffer + (werr ? 0 : d);
+                ++cases;
+            }
+            std::cout << name << ": " << cases << " cases " <<
+                mismatches << " mismatches" << std::endl;
+        }
+
+        void UnitTest(const char *in, size_t d,
+                u64t r = radLimits<B>::top, u64t b = 0) {
+            char buffer[32];
+            strcpy(buffer, in);  // NOLINT
+            char *t = buffer;
+            u64t error = 0, v = 7;
+            (*this)(v, t, error, d, r, b);
+            std::cout <<
+                std::setw(21) << in <<
+                std::setw(21) << v << " " <<
+                std::setw(2) << (t - buffer) << " " <<
+                error << std::endl;
+        }
+#endif
+
+     private:
+        template <size_t N>
+        inline void column(u64r m, s08pr s, u64t &e, u64r r) {  // NOLINT
+            u64t t;
+            e ||
+            (e |= this->inv[N][static_cast<u08t>(*s)]) ||
+            (e |= ((t = this->col[N][static_cast<u08t>(*s)]) > r)) ||
+            ((r -= t), (m += t), (++s));
+        }
+    };
+
+    typedef lexRadU64t<16> lexHexU64t;
+    typedef lexRadU64t<36> lexB36U64t;
+
+    static lexHexU64t lexHexU64_Instance;
+    static lexB36U64t lexB36U64_Instance;
+
+    ///########################################################################
+    /// Parallel parser for text holding one u64t per line, from memory or
+    /// from a file it maps.  The text is cut into chunks of about grain
+    /// bytes, each ending just past a newline.  A first parallel pass
+    /// counts each chunk's lines, so every chunk knows where its lines go
+    /// and the caller's column can be sized once; the second lexes every
+    /// line with lexDecU64t::delimited() straight into its slot.  Chunks
+    /// are dealt out in contiguous runs, one run per thread, and a thread
+    /// that finishes its run steals the remaining chunks of the others.
+    /// A line that is not 1 to 20 digits (an optional '\r' before the
+    /// '\n' is allowed) or is above 18446744073709551615 gets 0 in the
+    /// column and its byte offset in errors, in file order.
+    class lexLinesU64t {
+     public:
+        /// Lex size bytes at base into column; return the line count.
+        size_t operator()(
+                const char *base,
+                size_t size,
+                std::vector<u64t> &column,                          // NOLINT
+                std::vector<u64t> &errors,                          // NOLINT
+                size_t threads = 0,
+                size_t grain = 1 << 20) {
+            if (!threads) threads = std::thread::hardware_concurrency();
+            if (!threads) threads = 1;
+            if (!grain) grain = 1;
+            std::vector<size_t> cut(1, 0);   ///< chunk boundaries
+            while (cut.back() < size) {
+                size_t at = cut.back() + grain;
+                if (at >= size) {
+                    at = size;
+                } else {
+                    const void *nl = memchr(base + at, '\n', size - at);
+                    at = nl ? static_cast<const char *>(nl) - base + 1 : size;
+                }
+                cut.push_back(at);
+            }
+            const size_t chunks = cut.size() - 1;
+            std::vector<size_t> first(chunks + 1, 0);
+            std::vector<std::vector<u64t> > bad(chunks);
+
+            run(chunks, threads, [&](size_t c) {
+                size_t n = 0;
+                for (const char *p = base + cut[c], *end = base + cut[c + 1];
+                        (p = static_cast<const char *>(
+                            memchr(p, '\n', end - p))); ++p) ++n;
+                first[c + 1] = n + (c + 1 == chunks && size &&
+                        base[size - 1] != '\n');
+            });
+            for (size_t c = 0; c < chunks; ++c) first[c + 1] += first[c];
+            column.resize(first[chunks]);
+
+            run(chunks, threads, [&](size_t c) {
+                u64t *out = column.data() + first[c];
+                const char *p = base + cut[c], *end = base + cut[c + 1];
+                while (p < end) {
+                    const char *nl = static_cast<const char *>(
+                        memchr(p, '\n', end - p));
+                    if (!nl) {
+                        *out++ = last(p, end, bad[c], base);
+                        break;
+                    }
+                    *out++ = line(p, nl, bad[c], p - base);
+                    p = nl + 1;
+                }
+            });
+            errors.clear();
+            for (size_t c = 0; c < chunks; ++c) {
+                errors.insert(errors.end(), bad[c].begin(), bad[c].end());
+            }
+            return column.size();
+        }
+
+#if defined(__unix__) || defined(__APPLE__)
+        /// Map the file at path and lex it as above; e is set, and the
+        /// column and errors are left empty, if it cannot be read.
+        size_t map(
+                const char *path,
+                std::vector<u64t> &column,                          // NOLINT
+                std::vector<u64t> &errors,                          // NOLINT
+                u64t &e,                                            // NOLINT
+                size_t threads = 0,
+                size_t grain = 1 << 20) {
+            column.clear();
+            errors.clear();
+            if (e) return 0;
+            const int fd = open(path, O_RDONLY);
+            struct stat st;
+            if ((e |= (fd < 0))) return 0;
+            if ((e |= (fstat(fd, &st) != 0))) {
+                close(fd);
+                return 0;
+            }
+            const size_t size = static_cast<size_t>(st.st_size);
+            void *m = size ? mmap(0, size, PROT_READ, MAP_PRIVATE, fd, 0) : 0;
+            close(fd);
+            if ((e |= (m == MAP_FAILED))) return 0;
+            if (size) madvise(m, size, MADV_WILLNEED);
+            const size_t lines = (*this)(static_cast<const char *>(m), size,
+                    column, errors, threads, grain);
+            if (size) munmap(m, size);
+            return lines;
+        }
+#endif
+
+#ifdef LETTVIN_LEXERS_H_CPP_UNIT
+        /// Lex lines with bad ones mixed in, in memory and through a
+        /// file, with chunks small enough that every thread steals, and
+        /// compare with a serial line-by-line pass.
+        void UnitTest() {
+            std::string text;
+            std::vector<u64t> want, wrong;
+            u64t x = 20160524ULL;   ///< LCG state
+            const char *junk[] = {
+                "", "12a", "-1", " 7", "18446744073709551616", "1\r\r",
+                "000000000000000000001"
+            };
+            for (size_t i = 0; i < 20000; ++i) {
+                x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+                char buffer[32];
+                if ((x >> 58) == 0) {
+                    wrong.push_back(text.size());
+                    want.push_back(0);
+                    text += junk[(x >> 33) % 7];
+                } else {
+                    want.push_back(x >> (x >> 58));
+                    snprintf(buffer, sizeof(buffer), "%llu%s",
+                            static_cast<unsigned long long>(want.back()),
+                            (x >> 20) % 16 ? "" : "\r");
+                    text += buffer;
+                }
+                if (i + 1 < 20000) text += '\n';
+            }
+            std::vector<u64t> column, errors;
+            size_t lines = (*this)(text.c_str(), text.size(), column,
+                    errors, 4, 4096);
+            size_t mismatches = (column != want) + (errors != wrong);
+            std::cout << "lines: " << lines << " lines " << errors.size() <<
+                " errors " << mismatches << " mismatches" << std::endl;
+#if defined(__unix__) || defined(__APPLE__)
+            const char *path = "atoull.lines.txt";
+            std::ofstream(path) << text << '\n';
+            u64t e = 0;
+            lines = map(path, column, errors, e, 3, 65536);
+            mismatches = e + (column != want) + (errors != wrong);
+            remove(path);
+            std::cout << "lines (mapped): " << lines << " lines " <<
+                errors.size() << " errors " << mismatches <<
+                " mismatches" << std::endl;
+#endif
+        }
+#endif
+
+     private:
+        /// Call work(c) for every chunk c < chunks on threads threads.
+        /// Thread t owns the run [t * chunks / threads, (t + 1) * ...)
+        /// and takes from its front; once empty it steals from the
+        /// front of every other run in turn.
+        template <typename W>
+        static void run(size_t chunks, size_t threads, W work) {
+            if (threads > chunks) threads = chunks ? chunks : 1;
+            std::vector<std::atomic<size_t> > next(threads);
+            std::vector<size_t> end(threads);
+            for (size_t t = 0; t < threads; ++t) {
+                next[t] = t * chunks / threads;
+                end[t] = (t + 1) * chunks / threads;
+            }
+            auto worker = [&](size_t t) {
+                for (size_t k = 0; k < threads; ++k) {
+                    const size_t v = (t + k) % threads;
+                    for (size_t c; (c = next[v]++) < end[v]; ) work(c);
+                }
+            };
+            std::vector<std::thread> pool;
+            for (size_t t = 1; t < threads; ++t) pool.emplace_back(worker, t);
+            worker(0);
+            for (size_t t = 0; t < pool.size(); ++t) pool[t].join();
+        }
+
+        /// Lex the line [p, nl), noting offset in bad if it fails; nl is
+        /// a newline, which stops the lexer.
+        static u64t line(const char *p, const char *nl,
+                std::vector<u64t> &bad, u64t offset) {  // NOLINT
+            char *s = const_cast<char *>(p);
+            u64t v = 0, e = 0;
+            lexDecU64_Instance.delimited(v, s, e);
+            e |= (s + (*s == '\r') != nl);
+            if (e) bad.push_back(offset);
+            return e ? 0 : v;
+        }
+
+        /// The last line has no newline; lex a terminated copy, so the
+        /// lexer never looks past the end of the text.  Over 24 bytes
+        /// is too long to be good, and stays too long when cut to 24.
+        static u64t last(const char *p, const char *end,
+                std::vector<u64t> &bad, const char *base) {  // NOLINT
+            char copy[32];
+            const size_t n = end - p < 24 ? end - p : 24;
+            memcpy(copy, p, n);
+            copy[n] = '\n';
+            return line(copy, copy + n, bad, p - base);
+        }
+    };
+
+    static lexLinesU64t lexLinesU64_Instance;
+
+#if defined(__unix__) || defined(__APPLE__)
+    ///########################################################################
+    /// Column cache: lex a one-number-per-line file (as lexLinesU64t) once,
+    /// and keep the result in a binary sidecar that later opens map in
+    /// place of lexing.  The sidecar (path + ".u64" unless named) is:
+    ///
+    ///   header   8 u64t: magic, source size, source mtime (ns), values,
+    ///            errors, 3 reserved 0
+    ///   values   the column, one u64t per line, from byte 64
+    ///   errors   byte offsets of the bad lines, as lexLinesU64t gives
+    ///
+    /// all little-endian, so the column is 64 byte aligned in the map and
+    /// read as it lies.  A sidecar whose size and mtime do not match the
+    /// source, or whose length does not match its header, is stale: the
+    /// source is lexed again and the sidecar replaced (written beside it
+    /// and renamed, so a reader never maps half a file).  The column is
+    /// served from memory when the sidecar cannot be written, when the
+    /// source changed while it was lexed, and on big-endian hosts.
+    ///
+    /// lexCacheU64t data;
+    /// data.open("ids.txt", e);
+    /// for (size_t i = 0; i < data.size(); ++i) total += data.values()[i];
+    class lexCacheU64t {
+     public:
+        lexCacheU64t() : map_(0), bytes_(0), values_(0), errors_(0),
+            size_(0), failed_(0), cached_(false) {}
+        ~lexCacheU64t() { release(); }
+
+        /// Open the column of the text file at path, from its sidecar if
+        /// that is current, else by lexing; return the line count.  e is
+        /// set, and the column left empty, if the source cannot be read.
+        size_t open(
+                const char *path,
+                u64t &e,                                            // NOLINT
+                const char *sidecar = 0,
+                size_t threads = 0) {
+            release();
+            if (e) return 0;
+            const std::string side = sidecar ? sidecar :
+                std::string(path) + ".u64";
+            struct stat st;
+            if ((e |= (stat(path, &st) != 0))) return 0;
+            const u64t key[2] = { u64t(st.st_size), mtime(st) };
+            if (little() && attach(side.c_str(), key)) return size_;
+            lexLinesU64_Instance.map(path, column_, bad_, e, threads);
+            if (e) return 0;
+            values_ = column_.data();
+            errors_ = bad_.data();
+            size_ = column_.size();
+            failed_ = bad_.size();
+            const bool same = stat(path, &st) == 0 &&
+                u64t(st.st_size) == key[0] && mtime(st) == key[1];
+            if (little() && same) store(side.c_str(), key);
+            return size_;
+        }
+
+        const u64t *values() const { return values_; }
+        size_t size() const { return size_; }
+        const u64t *errors() const { return errors_; }
+        size_t failed() const { return failed_; }
+        bool cached() const { return cached_; }   ///< mapped, not lexed
+
+#ifdef LETTVIN_LEXERS_H_CPP_UNIT
+        /// Open a file of good and bad lines four ways: first (lexed and
+        /// stored), again (mapped), after a same-size edit with a new
+        /// mtime and after a damaged sidecar (both lexed again), and
+        /// compare each column and error list with lexLinesU64t's.
+        static void UnitTest() {
+            const char *path = "atoull.cache.txt";
+            const char *side = "atoull.cache.txt.u64";
+            std::string text;
+            u64t x = 20160530ULL;   ///< LCG state
+            for (size_t i = 0; i < 5000; ++i) {
+                x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+                char buffer[32];
+                snprintf(buffer, sizeof(buffer), (x >> 58) ? "%llu\n" :
+                        "%llux\n", static_cast<unsigned long long>(
+                            x >> (x >> 58)));
+                text += buffer;
+            }
+            std::ofstream(path) << text;
+            remove(side);
+            size_t mismatches = 0;
+            const bool want[] = { false, true, false, false };
+            for (size_t pass = 0; pass < 4; ++pass) {
+                if (pass == 2) {
+                    text[0] = text[0] == '1' ? '2' : '1';
+                    std::ofstream(path) << text;
+                    struct timespec when[2] = {{0, UTIME_OMIT}, {1, 0}};
+                    utimensat(AT_FDCWD, path, when, 0);
+                }
+                if (pass == 3) std::ofstream(side) << "short";
+                std::vector<u64t> column, errors;
+                lexLinesU64_Instance(text.data(), text.size(), column,
+                        errors, 1);
+                lexCacheU64t cache;
+                u64t e = 0;
+                const size_t n = cache.open(path, e, side);
+                mismatches += e || n != column.size() ||
+                    cache.cached() != want[pass] ||
+                    cache.failed() != errors.size() ||
+                    !std::equal(column.begin(), column.end(),
+                            cache.values()) ||
+                    !std::equal(errors.begin(), errors.end(),
+                            cache.errors());
+                if (pass == 1) {
+                    mismatches += reinterpret_cast<uintptr_t>(
+                            cache.values()) % 64 != 0;
+                }
+                if (pass == 3) std::cout << "cache: " << n << " lines " <<
+                    cache.failed() << " errors " << mismatches <<
+                    " mismatches" << std::endl;
+            }
+            lexCacheU64t cache;
+            u64t e = 0;
+            remove(path);
+            cache.open(path, e, side);
+            std::cout << "cache (missing source): e " << e << " size " <<
+                cache.size() << std::endl;
+            remove(side);
+        }
+#endif
+
+     private:
+        static const u64t magic = 0x31304C4C554F5441ULL;   ///< "ATOULL01"
+        static const size_t head = 8;   ///< header u64t; 64 bytes
+
+        lexCacheU64t(const lexCacheU64t &);
+        lexCacheU64t &operator=(const lexCacheU64t &);
+
+        static bool little() {
+            const u16t one = 1;
+            u08t low;
+            memcpy(&low, &one, 1);
+            return low == 1;
+        }
+
+        static u64t mtime(const struct stat &st) {
+#ifdef __APPLE__
+            return u64t(st.st_mtimespec.tv_sec) * 1000000000ULL +
+                u64t(st.st_mtimespec.tv_nsec);
 #else
-        { True48, false, false, B00001000(false), True198},
-        { True48, false, false, B00001000(false), True198},
-        { True48, false, false, B00001000(false), True198},
-        { True48, false, false, B00001000(false), True198},
-        { True48, false, false, B00001000(false), True198},
-        { True48, false, false, B00001000(false), True198},
-        { True48, false, false, B00001000(false), True198},
-        { True48, false, false, B00001000(false), True198},
-        { True48, false, false, B00001000(false), True198},
-        { True48, false, false, B00001000(false), True198},
-        { True48, false, false, B00001000(false), True198},
-        { True48, false, false, B00001000(false), True198},
-        { True48, false, false, B00001000(false), True198},
-        { True48, false, false, B00001000(false), True198},
-        { True48, false, false, B00001000(false), True198},
-        { True48, false, false, B00001000(false), True198},
-        { True48, false, false, B00001000(false), True198},
-        { True48, false, false, B00001000(false), True198},
-        { True48, false, false, B00001000(false), True198},
-        { True48, false, false, B00001000(true),  True198}
+            return u64t(st.st_mtim.tv_sec) * 1000000000ULL +
+                u64t(st.st_mtim.tv_nsec);
 #endif
+        }
+
+        /// Map side if its header matches key and its length the header.
+        bool attach(const char *side, const u64t key[2]) {
+            const int fd = ::open(side, O_RDONLY);
+            if (fd < 0) return false;
+            struct stat st;
+            const bool sized = fstat(fd, &st) == 0 &&
+                size_t(st.st_size) >= head * sizeof(u64t);
+            void *m = sized ? mmap(0, size_t(st.st_size), PROT_READ,
+                    MAP_PRIVATE, fd, 0) : MAP_FAILED;
+            close(fd);
+            if (m == MAP_FAILED) return false;
+            const u64t *h = static_cast<const u64t *>(m);
+            const u64t bytes = u64t(st.st_size);
+            const u64t room = bytes / sizeof(u64t) - head;
+            if (h[0] != magic || h[1] != key[0] || h[2] != key[1] ||
+                    h[3] > room || h[4] != room - h[3]) {
+                munmap(m, size_t(bytes));
+                return false;
+            }
+            map_ = m;
+            bytes_ = size_t(bytes);
+            values_ = h + head;
+            size_ = size_t(h[3]);
+            errors_ = values_ + size_;
+            failed_ = size_t(h[4]);
+            cached_ = true;
+            return true;
+        }
+
+        /// Write the sidecar beside side and rename it over side; give up
+        /// quietly (the next open lexes again) if any step fails.
+        void store(const char *side, const u64t key[2]) const {
+            const std::string temp = std::string(side) + "." +
+                std::to_string(getpid());
+            const u64t h[head] = { magic, key[0], key[1], u64t(size_),
+                u64t(failed_), 0, 0, 0 };
+            FILE *f = fopen(temp.c_str(), "wb");
+            if (!f) return;
+            bool ok = fwrite(h, sizeof(u64t), head, f) == head &&
+                fwrite(values_, sizeof(u64t), size_, f) == size_ &&
+                fwrite(errors_, sizeof(u64t), failed_, f) == failed_;
+            ok = (fclose(f) == 0) && ok;
+            if (!ok || rename(temp.c_str(), side) != 0) remove(temp.c_str());
+        }
+
+        void release() {
+            if (map_) munmap(map_, bytes_);
+            map_ = 0;
+            bytes_ = 0;
+            column_.clear();
+            bad_.clear();
+            values_ = errors_ = 0;
+            size_ = failed_ = 0;
+            cached_ = false;
+        }
+
+        void *map_;                  ///< sidecar mapping, if cached
+        size_t bytes_;
+        std::vector<u64t> column_;   ///< lexed column, if not cached
+        std::vector<u64t> bad_;
+        const u64t *values_;
+        const u64t *errors_;
+        size_t size_;
+        size_t failed_;
+        bool cached_;
     };
+#endif
 
     ///########################################################################
-    /// Table of summable value for each column
-    const u64t lexDecU64t::col[ 20 ][ 256 ] = {
-#if Alternate
-#define DECU64COLTABLE(n) \
-        { Bad48, 0, \
-            1*p##n, 2*p##n, 3*p##n, 4*p##n, 5*p##n, \
-            6*p##n, 7*p##n, 8*p##n, 9*p##n, Bad198}
-        DECU64COLTABLE(0),
-        DECU64COLTABLE(1),
-        DECU64COLTABLE(2),
-        DECU64COLTABLE(3),
-        DECU64COLTABLE(4),
-        DECU64COLTABLE(5),
-        DECU64COLTABLE(6),
-        DECU64COLTABLE(7),
-        DECU64COLTABLE(8),
-        DECU64COLTABLE(9),
-        DECU64COLTABLE(A),
-        DECU64COLTABLE(B),
-        DECU64COLTABLE(C),
-        DECU64COLTABLE(D),
-        DECU64COLTABLE(E),
-        DECU64COLTABLE(F),
-        DECU64COLTABLE(G),
-        DECU64COLTABLE(H),
-        DECU64COLTABLE(I),
-        DECU64COLTABLE(J)
+    /// Pull lexer over a stream: an fd (pipes, sockets, files) or a
+    /// std::istream.  Values are separated by any run of ' ', '\t', '\r',
+    /// '\n' or ','; each value must be 1 to 20 digits within u64t.
+    /// Input is read into one fixed buffer.  When a value is cut off by
+    /// the end of what has been read, only its bytes (never more than 24:
+    /// a longer value is already an error and is skipped rather than
+    /// kept) move to the front before the next read, so memory stays at
+    /// the buffer size however long the stream runs.  64 bytes of slack
+    /// past the buffer take the vector lexers' loads and an end sentinel.
+    ///
+    /// lexStreamU64t in(0);             // or in(std::cin)
+    /// for (u64t v, e = 0; in(v, e); e = 0) if (e) report(in.offset());
+    ///
+    /// A std::istream is read a buffer at a time through its streambuf
+    /// (sgetn), which waits for a full buffer or the end of input; for a
+    /// live pipe or socket, where values should come as they arrive, give
+    /// the fd, whose reads return whatever is there.
+    ///
+    /// operator() returns false at the end of the stream (or when e is
+    /// already set, as no lexing is done then).  A bad value yields
+    /// v = 0 and sets e; offset() is the stream offset of the value last
+    /// returned.  failed() is true if the fd reported a read error.
+    class lexStreamU64t {
+     public:
+#if defined(__unix__) || defined(__APPLE__)
+        explicit lexStreamU64t(int fd, size_t size = 1 << 16)
+            : fd_(fd), in_(0) { init(size); }
+#endif
+        explicit lexStreamU64t(
+                std::istream &in, size_t size = 1 << 16)            // NOLINT
+            : fd_(-1), in_(&in) { init(size); }
+
+        bool operator()(u64r v, u64t &e) {  // NOLINT
+            if (e) return false;
+            for (;;) {
+                if (long_) {          ///< skipping an overlong value
+                    while (head_ < tail_ && !sep(buf_[head_])) ++head_;
+                    if (head_ == tail_ && !eof_) {
+                        refill();
+                        continue;
+                    }
+                    long_ = false;
+                    v = 0;
+                    e |= 1;
+                    return true;
+                }
+                while (head_ < tail_ && sep(buf_[head_])) ++head_;
+                size_t end = head_;
+                while (end < tail_ && !sep(buf_[end])) ++end;
+                if (end == tail_ && !eof_) {
+                    refill();
+                    continue;
+                }
+                if (head_ == tail_) return false;
+                at_ = base_ + head_;
+                char *s = &buf_[head_];
+                lexDecU64_Instance.delimited(v, s, e);
+                e |= (s != &buf_[end]);
+                if (e) v = 0;
+                head_ = end;
+                return true;
+            }
+        }
+
+        u64t offset() const { return at_; }
+        bool failed() const { return failed_; }
+
+#ifdef LETTVIN_LEXERS_H_CPP_UNIT
+        /// Stream random values, separators and bad values through a
+        /// buffer small enough that most values are cut by a read, from
+        /// a std::istream and from an fd, and compare with a direct split.
+        static void UnitTest() {
+            std::string text;
+            std::vector<u64t> want, wrong;
+            u64t x = 20160525ULL;   ///< LCG state
+            const char *junk[] = {
+                "12a", "-1", "18446744073709551616", "x",
+                "123456789012345678901234567890123456789012345678901234567890"
+            };
+            const char *gaps[] = { "\n", ",", " ", "\r\n", " ,\t" };
+            for (size_t i = 0; i < 20000; ++i) {
+                x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+                char buffer[32];
+                if ((x >> 58) == 0) {
+                    wrong.push_back(text.size());
+                    want.push_back(0);
+                    text += junk[(x >> 33) % 5];
+                } else {
+                    want.push_back(x >> (x >> 58));
+                    snprintf(buffer, sizeof(buffer), "%llu",
+                            static_cast<unsigned long long>(want.back()));
+                    text += buffer;
+                }
+                if (i + 1 < 20000) text += gaps[(x >> 20) % 5];
+            }
+            std::istringstream in(text);
+            lexStreamU64t lexer(in, 100);
+            size_t mismatches = compare(lexer, want, wrong);
+            std::cout << "stream: " << want.size() << " values " <<
+                wrong.size() << " errors " << mismatches <<
+                " mismatches" << std::endl;
+            synced buffer(text);
+            std::istream cin(&buffer);
+            lexStreamU64t lexer1(cin, 100);
+            mismatches = compare(lexer1, want, wrong) +
+                (buffer.reads > text.size() / 64) + !cin.eof();
+            std::cout << "stream (synced): " << want.size() << " values " <<
+                wrong.size() << " errors " << mismatches <<
+                " mismatches" << std::endl;
+#if defined(__unix__) || defined(__APPLE__)
+            const char *path = "atoull.stream.txt";
+            std::ofstream(path) << text;
+            const int fd = open(path, O_RDONLY);
+            lexStreamU64t lexer2(fd, 4096);
+            mismatches = compare(lexer2, want, wrong) + lexer2.failed();
+            close(fd);
+            remove(path);
+            std::cout << "stream (fd): " << want.size() << " values " <<
+                wrong.size() << " errors " << mismatches <<
+                " mismatches" << std::endl;
+#endif
+        }
+
+        /// A streambuf like std::cin's while synced with stdio: no get
+        /// area, so in_avail() is 0 and readsome() gets nothing, and each
+        /// call reads through (here from text), counted in reads.
+        struct synced : std::streambuf {
+            explicit synced(const std::string &text)
+                : text(text), at(0), reads(0) {}
+            int_type underflow() {
+                ++reads;
+                return at < text.size() ?
+                    traits_type::to_int_type(text[at]) : traits_type::eof();
+            }
+            int_type uflow() {
+                const int_type c = underflow();
+                at += at < text.size();
+                return c;
+            }
+            std::streamsize xsgetn(char *s, std::streamsize n) {
+                ++reads;
+                const size_t m = std::min(size_t(n), text.size() - at);
+                memcpy(s, text.data() + at, m);
+                at += m;
+                return static_cast<std::streamsize>(m);
+            }
+            const std::string &text;
+            size_t at, reads;
+        };
+
+        static size_t compare(lexStreamU64t &lexer,                 // NOLINT
+                const std::vector<u64t> &want,
+                const std::vector<u64t> &wrong) {
+            size_t i = 0, j = 0, mismatches = 0;
+            for (u64t v, e = 0; lexer(v, e); e = 0, ++i) {
+                mismatches += i >= want.size() || v != want[i];
+                if (e) mismatches += j >= wrong.size() ||
+                    lexer.offset() != wrong[j++];
+            }
+            return mismatches + (i != want.size()) + (j != wrong.size());
+        }
+#endif
+
+     private:
+        static const size_t slack = 64;
+        static const size_t most = 24;    ///< longest value kept across reads
+
+        static inline bool sep(char c) {
+            return c == '\n' || c == ',' || c == ' ' || c == '\r' ||
+                c == '\t';
+        }
+
+        void init(size_t size) {
+            buf_.assign((size < 2 * most ? 2 * most : size) + slack, ' ');
+            head_ = tail_ = 0;
+            base_ = at_ = 0;
+            eof_ = long_ = failed_ = false;
+        }
+
+        /// Keep the unfinished value (if short enough) at the front and
+        /// read after it; at the end of input put a separator after the
+        /// data so the last value ends.
+        void refill() {
+            size_t keep = tail_ - head_;
+            if (keep > most) {
+                long_ = true;
+                keep = 0;
+                at_ = base_ + head_;
+            }
+            if (keep) memmove(&buf_[0], &buf_[head_], keep);
+            base_ += tail_ - keep;
+            head_ = 0;
+            tail_ = keep;
+            const size_t room = buf_.size() - slack - tail_;
+            size_t got = 0;
+#if defined(__unix__) || defined(__APPLE__)
+            if (fd_ >= 0) {
+                ssize_t n;
+                while ((n = read(fd_, &buf_[tail_], room)) < 0 &&
+                        errno == EINTR) {}
+                failed_ |= (n < 0);
+                got = n > 0 ? static_cast<size_t>(n) : 0;
+            }
+#endif
+            if (in_) {            ///< readsome() gets 0 from a synced cin
+                std::streambuf *rd = in_->rdbuf();
+                got = rd ? static_cast<size_t>(rd->sgetn(&buf_[tail_],
+                            static_cast<std::streamsize>(room))) : 0;
+                if (!got) in_->setstate(std::ios::eofbit);
+            }
+            tail_ += got;
+            eof_ = !got;
+            if (eof_) buf_[tail_] = ' ';
+        }
+
+        int fd_;
+        std::istream *in_;
+        std::vector<char> buf_;
+        size_t head_, tail_;      ///< unread bytes are buf_[head_, tail_)
+        u64t base_;               ///< stream offset of buf_[0]
+        u64t at_;                 ///< stream offset of the last value
+        bool eof_, long_, failed_;
+    };
+
+    ///########################################################################
+    /// Schema columns for lexRecords: recColumn<T, hi, lo> lexes integral
+    /// T within [lo, hi]; recSkip passes over a column without lexing it.
+    template <typename T,
+              T H = std::numeric_limits<T>::max(),
+              T L = std::numeric_limits<T>::min()>
+    struct recColumn { typedef T type; };
+
+    struct recSkip { typedef recSkip type; };
+
+    ///########################################################################
+    /// Decoder for rows of integer fields separated by Sep ("," for CSV,
+    /// "\t" for TSV) and ended by '\n' (an optional '\r' before it is
+    /// allowed), lexed into one vector per column by a compile-time
+    /// schema:
+    ///
+    /// typedef lexRecords<',', recColumn<u64t>, recSkip,
+    ///         recColumn<u32t, 100000, 1> > orders;
+    /// orders::table columns;    // tuple of vector<u64t>, <recSkip>, <u32t>
+    /// size_t rows = orders()(base, size, columns, errors);
+    ///
+    /// The text is read once, 64 bytes at a time: vector compares give a
+    /// mask of the separators and newlines in the block and a mask of
+    /// the bytes that are neither those nor digits.  Each separator bit
+    /// ends a field whose length is the distance from the last, so it
+    /// goes straight to the counted lexer of its column (lexDecU64t for
+    /// u64t, lexDec<T> otherwise) with no strchr or digit-run scan; the
+    /// second mask, counted over the field, rejects the non-digits that
+    /// lexDecU64t and the swar() path would read as 0 (a sign on a signed
+    /// column and a '\r' before the '\n' are allowed).
+    /// A bad field (empty, non-digit, too long, or outside [lo, hi]) gets
+    /// 0 in its column and its byte offset in errors.  A short row gets
+    /// 0 in its missing columns and one error at its '\n'; fields past
+    /// the schema get an error each and are dropped.  recSkip columns
+    /// are never checked and their vectors stay empty.  There is no
+    /// quoting; pass base past any header line.
+    template <char Sep, typename... C>
+    class lexRecords {
+     public:
+        static const size_t N = sizeof...(C);
+        typedef std::tuple<std::vector<typename C::type>...> table;
+
+        /// Lex size bytes at base into columns; return the row count.
+        size_t operator()(
+                const char *base,
+                size_t size,
+                table &columns,                                     // NOLINT
+                std::vector<u64t> &errors) {                        // NOLINT
+            static const field_t *const fields =
+                dispatch(typename buildIndices<N>::type());
+            clear(columns, typename buildIndices<N>::type());
+            errors.clear();
+            size_t start = 0;       ///< offset of the open field
+            size_t others = 0;      ///< its bytes that are not digits
+            size_t k = 0;           ///< its column
+            size_t rows = 0;
+            for (size_t at = 0; at < size; at += 64) {
+                u64t delim, other;
+                masks(base + at, size - at < 64 ? size - at : 64,
+                        delim, other);
+                u64t done = 0;      ///< bits of fields already ended
+                for (; delim; delim &= delim - 1) {
+                    const size_t bit = bitCtz(delim);
+                    const u64t below = (1ULL << bit) - 1;
+                    others += bits(other & below & ~done);
+                    const bool nl = base[at + bit] == '\n';
+                    end(base, size, start, at + bit, others, k, nl, fields,
+                            columns, errors);
+                    rows += nl;
+                    start = at + bit + 1;
+                    done = below | (1ULL << bit);
+                }
+                others += bits(other & ~done);
+            }
+            if (start < size || k) {
+                end(base, size, start, size, others, k, true, fields,
+                        columns, errors);
+                ++rows;
+            }
+            return rows;
+        }
+
+#ifdef LETTVIN_LEXERS_H_CPP_UNIT
+        /// Decode random rows with bad fields, short rows, extra fields
+        /// and CRLF endings mixed in, and compare with what was written.
+        static void UnitTest() {
+            typedef lexRecords<Sep, recColumn<u64t>, recSkip,
+                    recColumn<s32t, 1000000, -1000000>,
+                    recColumn<u16t, 60000, 1> > schema;
+            std::string text;
+            std::vector<u64t> a, wrong;
+            std::vector<s32t> b;
+            std::vector<u16t> c;
+            u64t x = 20160528ULL;   ///< LCG state
+            const char *junk[] = {
+                "", "12a", "x", "+", "1 2", "123456789012345678901234"
+            };
+            const char *range[] = {
+                "18446744073709551616", "1000001", "-1000001",
+                "60001", "0"
+            };
+            const size_t rows = 3000;
+            for (size_t i = 0; i < rows; ++i) {
+                char field[4][32];
+                bool bad[4] = { false, false, false, false };
+                x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+                a.push_back(x >> (x >> 58));
+                b.push_back(static_cast<s32t>((x >> 20) % 2000001) -
+                        1000000);
+                c.push_back(static_cast<u16t>(1 + (x >> 40) % 60000));
+                snprintf(field[0], 32, "%llu",
+                        static_cast<unsigned long long>(a.back()));
+                snprintf(field[1], 32, "%s", junk[(x >> 8) % 6]);
+                snprintf(field[2], 32, "%d", b.back());
+                snprintf(field[3], 32, "%u", c.back());
+                for (size_t k = 0; k < 4; k += 1 + (k == 0)) {
+                    x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+                    if ((x >> 59) == 0) {
+                        snprintf(field[k], 32, "%s", (x >> 40) % 2 ?
+                                junk[(x >> 20) % 6] :
+                                range[k == 0 ? 0 : k == 2 ? 1 + (x & 1) :
+                                3 + (x & 1)]);
+                        bad[k] = true;
+                    }
+                }
+                x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+                const size_t shape = (x >> 56) % 32;  ///< 0 short, 1 long
+                const size_t count = shape == 0 && i + 1 < rows ?
+                    1 + (x >> 20) % 3 : 4;
+                for (size_t k = 0; k < count; ++k) {
+                    if (k) text += Sep;
+                    if (bad[k]) wrong.push_back(text.size());
+                    text += field[k];
+                }
+                if (shape == 1) {
+                    text += Sep;
+                    wrong.push_back(text.size());
+                    text += "7";
+                }
+                if ((x >> 20) % 8 == 0) text += '\r';
+                if (count < 4) wrong.push_back(text.size());
+                if (bad[0]) a.back() = 0;
+                if (bad[2] || count < 3) b.back() = 0;
+                if (bad[3] || count < 4) c.back() = 0;
+                if (i + 1 < rows) text += '\n';
+            }
+            typename schema::table columns;
+            std::vector<u64t> errors;
+            const size_t n = schema()(text.c_str(), text.size(), columns,
+                    errors);
+            const size_t mismatches = (n != rows) +
+                (std::get<0>(columns) != a) + (std::get<2>(columns) != b) +
+                (std::get<3>(columns) != c) + !std::get<1>(columns).empty() +
+                (errors != wrong);
+            std::cout << "records (" << (Sep == '\t' ? "tsv" : "csv") <<
+                "): " << n << " rows " << errors.size() << " errors " <<
+                mismatches << " mismatches" << std::endl;
+        }
+#endif
+
+     private:
+        typedef void (*field_t)(table &, const char *, size_t, size_t,
+                std::vector<u64t> &, u64t, size_t);
+
+        /// One lexing function per column, indexed by column.
+        template <size_t... I>
+        static const field_t *dispatch(indices<I...>) {
+            static const field_t each[] = { &field<I>... };
+            return each;
+        }
+
+        template <size_t... I>
+        static void clear(table &columns, indices<I...>) {  // NOLINT
+            int each[] = { (std::get<I>(columns).clear(), 0)... };
+            (void)each;
+        }
+
+        /// Count the bits of m, which in good text is 0: a test is
+        /// cheaper than the library call popcount is without -mpopcnt.
+        static inline size_t bits(u64t m) {
+            return m ? bitCount(m) : 0;
+        }
+
+        /// Set delim for the separators and newlines among the n bytes
+        /// at p, other for the bytes that are neither those nor digits.
+        static inline void masks(const char *p, size_t n,
+                u64t &delim, u64t &other) {  // NOLINT
+            char pad[64];
+            if (n < 64) {
+                memset(pad, '0', sizeof(pad));
+                memcpy(pad, p, n);
+                p = pad;
+            }
+#if LETTVIN_LEXDEC_SIMD
+            const __m128i sep = _mm_set1_epi8(Sep);
+            const __m128i nl = _mm_set1_epi8('\n');
+            const __m128i zero = _mm_set1_epi8('0');
+            const __m128i nine = _mm_set1_epi8(9);
+            delim = other = 0;
+            for (int i = 0; i < 64; i += 16) {
+                const __m128i x = _mm_loadu_si128(
+                        reinterpret_cast<const __m128i *>(p + i));
+                const u64t d = static_cast<u32t>(_mm_movemask_epi8(
+                        _mm_or_si128(_mm_cmpeq_epi8(x, sep),
+                            _mm_cmpeq_epi8(x, nl))));
+                const __m128i y = _mm_sub_epi8(x, zero);
+                const u64t g = static_cast<u32t>(_mm_movemask_epi8(
+                        _mm_cmpeq_epi8(_mm_max_epu8(y, nine), nine)));
+                delim |= d << i;
+                other |= (~(d | g) & 0xFFFF) << i;
+            }
 #else
-#define BAD48L(L) \
-        { Bad48, 0, \
-            1*p##L, 2*p##L, 3*p##L, 4*p##L, 5*p##L, \
-            6*p##L, 7*p##L, 8*p##L, 9*p##L, Bad198 }
-            BAD48L(0),
-        BAD48L(1),
-        BAD48L(2),
-        BAD48L(3),
-        BAD48L(4),
-        BAD48L(5),
-        BAD48L(6),
-        BAD48L(7),
-        BAD48L(8),
-        BAD48L(9),
-        BAD48L(A),
-        BAD48L(B),
-        BAD48L(C),
-        BAD48L(D),
-        BAD48L(E),
-        BAD48L(F),
-        BAD48L(G),
-        BAD48L(H),
-        BAD48L(I),
-        BAD48L(J)
+            delim = other = 0;
+            for (size_t i = 0; i < 64; ++i) {
+                const bool d = p[i] == Sep || p[i] == '\n';
+                delim |= u64t(d) << i;
+                other |= u64t(!d && static_cast<u08t>(p[i] - '0') > 9) << i;
+            }
 #endif
-};
+        }
 
-    static lexDecU64t lexDecU64_Instance;
+        /// End the field [start, stop) of column k; nl ends the row too.
+        static inline void end(const char *base, size_t size, size_t start,
+                size_t stop, size_t &others, size_t &k, bool nl,  // NOLINT
+                const field_t *fields, table &columns,      // NOLINT
+                std::vector<u64t> &errors) {                // NOLINT
+            size_t d = stop - start;
+            if (nl && d && base[stop - 1] == '\r') {
+                --d;
+                --others;
+            }
+            if (k < N) {
+                fields[k](columns, base + start, d, others, errors, start,
+                        size - start);
+            } else {
+                errors.push_back(start);
+            }
+            ++k;
+            others = 0;
+            if (!nl) return;
+            if (k < N) {
+                for (; k < N; ++k) fields[k](columns, 0, 0, 0, errors, 0, 0);
+                errors.push_back(stop);
+            }
+            k = 0;
+        }
+
+        /// Lex column I: d bytes at s with others non-digits among them
+        /// and room bytes of text from s on.  s null marks a column
+        /// missing from a short row.
+        template <size_t I>
+        static void field(table &columns, const char *s, size_t d,
+                size_t others, std::vector<u64t> &errors,  // NOLINT
+                u64t at, size_t room) {
+            put(std::get<I>(columns),
+                    typename std::tuple_element<I, std::tuple<C...> >::type(),
+                    s, d, others, errors, at, room);
+        }
+
+        static inline void put(std::vector<recSkip> &, recSkip,  // NOLINT
+                const char *, size_t, size_t, std::vector<u64t> &,  // NOLINT
+                u64t, size_t) {}
+
+        /// Unsigned fields of at most 16 digits, all checked by the masks,
+        /// are summed by swar(); the rest go to the column's lexer.
+        template <typename T, T H, T L>
+        static inline void put(std::vector<T> &out,                 // NOLINT
+                recColumn<T, H, L>, const char *s, size_t d, size_t others,
+                std::vector<u64t> &errors, u64t at, size_t room) {  // NOLINT
+            T v = 0;
+            if (s) {
+                if (std::numeric_limits<T>::is_signed && others && d &&
+                        (*s == '-' || *s == '+')) --others;
+                u64t e = (d == 0) | (others != 0);
+                if (!std::numeric_limits<T>::is_signed && !e && d <= 16 &&
+                        d <= decLimits<T>::D && (d > 8 || room >= 8)) {
+                    const u64t w = swar(s, d);
+                    e |= (w > u64t(H)) | (w < u64t(L));
+                    v = T(w);
+                } else {
+                    char *p = const_cast<char *>(s);
+                    lex(v, p, e, d, H, L);
+                }
+                if (e) {
+                    v = 0;
+                    errors.push_back(at);
+                }
+            }
+            out.push_back(v);
+        }
+
+        /// Value of 1 to 16 digits at s, reading s[0, max(d, 8)): each
+        /// 8 byte word, its digits moved to the top, is folded pairwise
+        /// into 2, 4 and then 8 digit sums.
+        static inline u64t swar(const char *s, size_t d) {
+            return d <= 8 ? eight(s, d) :
+                eight(s, d - 8) * 100000000ULL + eight(s + d - 8, 8);
+        }
+
+        static inline u64t eight(const char *s, size_t d) {
+            u64t w = 0;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            memcpy(&w, s, 8);
+#else
+            for (size_t k = 0; k < 8; ++k)
+                w |= u64t(static_cast<u08t>(s[k])) << (8 * k);
+#endif
+            w = (w - 0x3030303030303030ULL) << (8 * (8 - d));
+            w = ((w & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;
+            w = ((w & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+            return ((w & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32;
+        }
+
+        static inline void lex(u64t &v, char *&s, u64t &e,  // NOLINT
+                size_t d, u64t hi, u64t lo) {
+            lexDecU64_Instance(v, s, e, d, hi, lo);
+        }
+
+        template <typename T>
+        static inline void lex(T &v, char *&s, u64t &e,  // NOLINT
+                size_t d, T hi, T lo) {
+            lexDec<T>()(v, s, e, d, hi, lo);
+        }
+    };
+
+    template <typename... C> using lexCsv = lexRecords<',', C...>;
+    template <typename... C> using lexTsv = lexRecords<'\t', C...>;
+
+    ///########################################################################
+    /// Lazy input range over the u64t values in a buffer, one value per
+    /// field ending in sep (an optional '\r' before a '\n' sep is
+    /// allowed), lexed by lexDecU64t::delimited() one at a time as the
+    /// iterator advances, so filters and reductions read straight from
+    /// the buffer (or a mapped file) with no intermediate column:
+    ///
+    /// std::vector<u64t> errors;
+    /// lexRangeU64t values(base, size, ',', &errors);
+    /// for (u64t v : values) total += v;
+    /// values.rewind();
+    /// big = std::count_if(values.begin(), values.end(), over);
+    ///
+    /// Errors are out of band: a field that is not 1 to 20 digits within
+    /// [lo, hi] is skipped, counted by failed(), and its byte offset is
+    /// appended to *errors when errors is given.  The range is single
+    /// pass like an istream: begin() continues from where the last
+    /// iterator stopped, and rewind() starts over.
+    class lexRangeU64t {
+     public:
+        class iterator {
+         public:
+            typedef std::input_iterator_tag iterator_category;
+            typedef u64t value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const u64t *pointer;
+            typedef const u64t &reference;
+
+            iterator() : range_(0), v_(0) {}
+            explicit iterator(lexRangeU64t *range) : range_(range), v_(0) {
+                ++*this;
+            }
+
+            reference operator*() const { return v_; }
+            pointer operator->() const { return &v_; }
+            iterator &operator++() {
+                if (range_ && !range_->next(v_)) range_ = 0;
+                return *this;
+            }
+            iterator operator++(int) {
+                iterator was(*this);
+                ++*this;
+                return was;
+            }
+            bool operator==(const iterator &o) const {
+                return range_ == o.range_;
+            }
+            bool operator!=(const iterator &o) const {
+                return range_ != o.range_;
+            }
+
+         private:
+            lexRangeU64t *range_;    ///< null at the end
+            u64t v_;
+        };
+
+        lexRangeU64t(
+                const char *base,
+                size_t size,
+                char sep = '\n',
+                std::vector<u64t> *errors = 0,
+                u64t hi = ~0ULL,
+                u64t lo = 0)
+            : base_(base), end_(base + size), p_(base), sep_(sep),
+              errors_(errors), hi_(hi), lo_(lo), failed_(0) {}
+
+        iterator begin() { return iterator(this); }
+        iterator end() { return iterator(); }
+
+        void rewind() {
+            p_ = base_;
+            failed_ = 0;
+        }
+
+        size_t failed() const { return failed_; }
+
+#ifdef LETTVIN_LEXERS_H_CPP_UNIT
+        /// Walk random fields, bad ones mixed in, with a range-based for
+        /// and with std::accumulate, with digits lying just past the end
+        /// of the buffer, and compare with what was written.
+        static void UnitTest() {
+            std::string text;
+            std::vector<u64t> want, wrong;
+            u64t x = 20160530ULL;   ///< LCG state
+            const char *junk[] = {
+                "", "12a", "-1", " 7", "18446744073709551616", "x", "1\r\r",
+                "123456789012345678901234567890"
+            };
+            const char sep = ',';
+            for (size_t i = 0; i < 20000; ++i) {
+                x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+                if ((x >> 58) == 0) {
+                    wrong.push_back(text.size());
+                    text += junk[(x >> 33) % 8];
+                } else {
+                    want.push_back(x >> (x >> 58));
+                    char buffer[32];
+                    snprintf(buffer, sizeof(buffer), "%llu",
+                            static_cast<unsigned long long>(want.back()));
+                    text += buffer;
+                }
+                if (i + 1 < 20000) text += sep;
+            }
+            const size_t size = text.size();
+            text += "9876543210";   ///< must not join the last field
+            size_t mismatches = 0;
+            std::vector<u64t> errors;
+            lexRangeU64t range(text.data(), size, sep, &errors);
+            std::vector<u64t> got;
+            for (u64t v : range) got.push_back(v);
+            mismatches += (got != want) + (errors != wrong) +
+                (range.failed() != wrong.size());
+            range.rewind();
+            const u64t sum = std::accumulate(range.begin(), range.end(),
+                    u64t(0));
+            mismatches += sum != std::accumulate(want.begin(), want.end(),
+                    u64t(0));
+            const char *four = "1\n22\r\n333\n\n4444";
+            lexRangeU64t lines(four, strlen(four));
+            got.assign(lines.begin(), lines.end());
+            mismatches += got.size() != 4 || got[3] != 4444 ||
+                lines.failed() != 1;
+            std::cout << "range: " << want.size() << " values " <<
+                wrong.size() << " errors " << mismatches <<
+                " mismatches" << std::endl;
+        }
+#endif
+
+     private:
+        /// Lex fields from p_ until one is good; false at the end.
+        bool next(u64r v) {  // NOLINT
+            while (p_ < end_) {
+                const char *at = p_;
+                char copy[32];
+                char *s = const_cast<char *>(p_), *o = s;
+                const bool near = end_ - p_ < 32;
+                if (near) {               ///< lex a terminated copy
+                    const size_t n = end_ - p_ < 24 ? end_ - p_ : 24;
+                    memcpy(copy, p_, n);
+                    memset(copy + n, sep_, sizeof(copy) - n);
+                    s = o = copy;
+                }
+                u64t e = 0;
+                lexDecU64_Instance.delimited(v, s, e, hi_, lo_);
+                if (sep_ == '\n' && *s == '\r') ++s;
+                const char *stop = p_ + (s - o);
+                if (!e && (stop == end_ || *stop == sep_)) {
+                    p_ = stop + (stop < end_);
+                    return true;
+                }
+                const void *f = memchr(at, sep_, end_ - at);
+                p_ = f ? static_cast<const char *>(f) + 1 : end_;
+                ++failed_;
+                if (errors_) errors_->push_back(at - base_);
+            }
+            return false;
+        }
+
+        const char *base_, *end_, *p_;
+        char sep_;
+        std::vector<u64t> *errors_;
+        u64t hi_, lo_;
+        size_t failed_;
+    };
+
+    ///########################################################################
+    /// Fused lex and filter: the values of a buffer of delimited fields
+    /// (one per field ending in sep, an optional '\r' before a '\n' sep
+    /// allowed) that lie in [lo, hi], with everything else counted, not
+    /// stored.  Out-of-range and malformed fields are told apart: a field
+    /// that is not 1 to 20 digits is malformed (its byte offset goes to
+    /// errors); one of good digits outside [lo, hi], including any above
+    /// 18446744073709551615, is above() or below().
+    ///
+    /// lexFilterU64t ids(lo, hi);
+    /// ids(base, size, &values, &rows, &errors);
+    ///
+    /// Separators and non-digits are masked 64 bytes at a time, which
+    /// checks every field and gives its width.  The leading column then
+    /// decides most fields outside a narrow range without lexing them: a
+    /// field with no leading zero is below lo when it has fewer digits
+    /// than lo, or as many and a smaller first digit, and above hi
+    /// likewise.  Only the rest are lexed and compared; early() counts
+    /// those that were not.  A value both below lo and above hi (lo > hi)
+    /// counts as below.  rows gets the field number of each kept value,
+    /// counted over every call since construction or reset(), so
+    /// successive buffers of one file, cut after a sep, number their
+    /// fields as one.
+    class lexFilterU64t {
+     public:
+        explicit lexFilterU64t(u64t lo = 0, u64t hi = ~0ULL, char sep = '\n')
+            : lo_(lo), hi_(hi), sep_(sep), wlo_(width(lo)), whi_(width(hi)),
+              llo_(lead(lo)), lhi_(lead(hi)) { reset(); }
+
+        /// Append to values (and rows) each value in [lo, hi] of the
+        /// fields in size bytes at base; return how many were kept.
+        size_t operator()(
+                const char *base,
+                size_t size,
+                std::vector<u64t> *values,
+                std::vector<u64t> *rows = 0,
+                std::vector<u64t> *errors = 0) {
+            return each(base, size, [values, rows](u64t v, u64t row) {
+                if (values) values->push_back(v);
+                if (rows) rows->push_back(row);
+            }, errors);
+        }
+
+        /// As operator(), but call kept(v, row) for each value kept, so
+        /// a caller can reduce the values with no column in between.
+        /// Separators and non-digits are found 64 bytes at a time, as in
+        /// lexRecords, so no field waits on the end of the one before.
+        template <typename F>
+        size_t each(
+                const char *base,
+                size_t size,
+                F kept,
+                std::vector<u64t> *errors = 0) {
+            const size_t was = kept_;
+            size_t start = 0;       ///< offset of the open field
+            size_t others = 0;      ///< its bytes that are not digits
+            for (size_t at = 0; at < size; at += 64) {
+                u64t delim, other;
+                masks(base + at, size - at < 64 ? size - at : 64,
+                        delim, other);
+                u64t done = 0;      ///< bits of fields already ended
+                for (; delim; delim &= delim - 1) {
+                    const size_t bit = bitCtz(delim);
+                    const u64t below = (1ULL << bit) - 1;
+                    others += bits(other & below & ~done);
+                    end(base, start, at + bit, others, true, kept, errors);
+                    start = at + bit + 1;
+                    others = 0;
+                    done = below | (1ULL << bit);
+                }
+                others += bits(other & ~done);
+            }
+            if (start < size)
+                end(base, start, size, others, false, kept, errors);
+            return kept_ - was;
+        }
+
+        void reset() { fields_ = kept_ = above_ = below_ = malformed_ =
+            early_ = 0; }
+
+        size_t fields() const { return fields_; }
+        size_t kept() const { return kept_; }
+        size_t above() const { return above_; }
+        size_t below() const { return below_; }
+        size_t malformed() const { return malformed_; }
+        size_t early() const { return early_; }   ///< decided unlexed
+
+#ifdef LETTVIN_LEXERS_H_CPP_UNIT
+        /// Filter random fields of every width, some with leading zeros,
+        /// some too high for u64t and some malformed, through ranges from
+        /// a single value to everything, in one buffer and in two, and
+        /// compare with lexing each field and testing it.
+        static void UnitTest() {
+            const char *junk[] = {
+                "", "12a", "-1", " 7", "x", "1\r\r",
+                "123456789012345678901234567890",
+                "000000000000000000001"
+            };
+            const u64t ranges[][2] = {
+                {0, ~0ULL}, {1000, 99999}, {12345678901ULL, 98765432109ULL},
+                {7, 7}, {500, 400}, {0, 0}, {10000000000000000000ULL, ~0ULL}
+            };
+            const char seps[] = {'\n', ','};
+            size_t cases = 0, mismatches = 0;
+            for (size_t k = 0; k < 2; ++k) {
+                const char sep = seps[k];
+                std::string text;
+                std::vector<std::string> field;
+                std::vector<size_t> at;
+                u64t x = 20160531ULL;   ///< LCG state
+                for (size_t i = 0; i < 5000; ++i) {
+                    x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+                    char buffer[48];
+                    if ((x >> 59) == 0) {
+                        snprintf(buffer, sizeof(buffer), "%s",
+                                junk[(x >> 33) % 8]);
+                    } else if ((x >> 59) == 1) {
+                        snprintf(buffer, sizeof(buffer), "%llu%u",
+                                static_cast<unsigned long long>(x >> 1),
+                                static_cast<unsigned>(x >> 40) % 10);
+                    } else {
+                        snprintf(buffer, sizeof(buffer), "%0*llu",
+                                static_cast<int>(x >> 20) % 4,
+                                static_cast<unsigned long long>(
+                                    x >> (x >> 58)));
+                    }
+                    at.push_back(text.size());
+                    field.push_back(buffer);
+                    text += buffer;
+                    if (sep == '\n' && (x >> 16) % 8 == 0 &&
+                            field.back() != "1\r\r") text += '\r';
+                    if (i + 1 < 5000) text += sep;
+                }
+                for (size_t r = 0; r < sizeof(ranges) / sizeof(ranges[0]);
+                        ++r) {
+                    const u64t lo = ranges[r][0], hi = ranges[r][1];
+                    std::vector<u64t> values, rows, errors;
+                    std::vector<u64t> want, wrows, wrong;
+                    size_t above = 0, below = 0;
+                    for (size_t i = 0; i < field.size(); ++i) {
+                        const std::string &f = field[i];
+                        u64t v = 0;
+                        bool good = !f.empty() && f.size() <= 20,
+                             over = false;
+                        for (size_t j = 0; good && j < f.size(); ++j) {
+                            const u64t c = static_cast<u08t>(f[j]) - '0';
+                            good = c < 10;
+                            over = over || v > (~0ULL - c) / 10;
+                            v = v * 10 + c;
+                        }
+                        if (!good) {
+                            wrong.push_back(at[i]);
+                        } else if (!over && v < lo) {
+                            ++below;
+                        } else if (over || v > hi) {
+                            ++above;
+                        } else {
+                            want.push_back(v);
+                            wrows.push_back(i);
+                        }
+                    }
+                    lexFilterU64t filter(lo, hi, sep);
+                    const size_t half = at[field.size() / 2];
+                    const std::string tail = text.substr(half) + "99";
+                    size_t kept = filter(text.data(), half, &values, &rows,
+                            &errors);
+                    std::vector<u64t> late;
+                    kept += filter(tail.data(), tail.size() - 2, &values,
+                            &rows, &late);
+                    for (size_t i = 0; i < late.size(); ++i)
+                        errors.push_back(late[i] + half);
+                    mismatches += values != want || rows != wrows ||
+                        errors != wrong || kept != want.size() ||
+                        filter.kept() != want.size() ||
+                        filter.above() != above || filter.below() != below ||
+                        filter.malformed() != wrong.size() ||
+                        filter.fields() != field.size();
+                    cases += field.size();
+                    if (sep == '\n' && lo == 1000) {
+                        std::cout << "filter [1000, 99999]: " <<
+                            filter.kept() << " kept " << filter.above() <<
+                            " above " << filter.below() << " below " <<
+                            filter.malformed() << " bad " <<
+                            filter.early() << " early" << std::endl;
+                    }
+                }
+            }
+            std::cout << "filter: " << cases << " cases " << mismatches <<
+                " mismatches" << std::endl;
+        }
+#endif
+
+     private:
+        /// Count the field [start, stop): keep it, or count it outside or
+        /// malformed; others is how many of its bytes are not digits and
+        /// closed is whether a byte (sep or '\r') follows it in the buffer.
+        template <typename F>
+        inline void end(const char *base, size_t start, size_t stop,
+                size_t others, bool closed, F &kept,        // NOLINT
+                std::vector<u64t> *errors) {
+            size_t d = stop - start;
+            if (sep_ == '\n' && d && base[stop - 1] == '\r') {
+                --d;
+                --others;
+            }
+            u64t v;
+            if (others || d - 1 >= 20) {
+                ++malformed_;
+                if (errors) errors->push_back(start);
+            } else if (keep(base + start, d, closed, v)) {
+                kept(v, u64t(fields_));
+                ++kept_;
+            }
+            ++fields_;
+        }
+
+        /// Set delim for the sep bytes among the n bytes at p, other for
+        /// the bytes that are neither sep nor digits.
+        inline void masks(const char *p, size_t n,
+                u64t &delim, u64t &other) const {  // NOLINT
+            char pad[64];
+            if (n < 64) {
+                memset(pad, '0', sizeof(pad));
+                memcpy(pad, p, n);
+                p = pad;
+            }
+            delim = other = 0;
+#if LETTVIN_LEXDEC_SIMD
+            const __m128i sep = _mm_set1_epi8(sep_);
+            const __m128i zero = _mm_set1_epi8('0');
+            const __m128i nine = _mm_set1_epi8(9);
+            for (int i = 0; i < 64; i += 16) {
+                const __m128i x = _mm_loadu_si128(
+                        reinterpret_cast<const __m128i *>(p + i));
+                const u64t d = static_cast<u32t>(_mm_movemask_epi8(
+                        _mm_cmpeq_epi8(x, sep)));
+                const __m128i y = _mm_sub_epi8(x, zero);
+                const u64t g = static_cast<u32t>(_mm_movemask_epi8(
+                        _mm_cmpeq_epi8(_mm_max_epu8(y, nine), nine)));
+                delim |= d << i;
+                other |= (~(d | g) & 0xFFFF) << i;
+            }
+#else
+            for (size_t i = 0; i < 64; ++i) {
+                const bool d = p[i] == sep_;
+                delim |= u64t(d) << i;
+                other |= u64t(!d && static_cast<u08t>(p[i] - '0') > 9) << i;
+            }
+#endif
+        }
+
+        static inline size_t bits(u64t m) {
+            return m ? bitCount(m) : 0;
+        }
+
+        /// Classify the good field of d digits at s; true, with v, if kept.
+        /// A closed field is lexed by delimited(), whose sweep takes every
+        /// width on one path; the last field of a buffer is counted, as
+        /// the bytes past it are not the caller's.
+        bool keep(const char *s, size_t d, bool closed,
+                u64r v) {                                   // NOLINT
+            const bool lead = *s != '0';
+            const bool below = lead &
+                ((d < wlo_) | ((d == wlo_) & (*s < llo_)));
+            const bool above = lead &
+                ((d > whi_) | ((d == whi_) & (*s > lhi_)));
+            if (below | above) {      ///< one branch, taken for most
+                ++early_;
+                below_ += below;
+                above_ += !below;
+                return false;
+            }
+            char *t = const_cast<char *>(s);
+            u64t e = 0;
+            if (closed) {
+                lexDecU64_Instance.delimited(v, t, e);
+            } else {
+                lexDecU64_Instance(v, t, e, d);
+            }
+            if (!e && v < lo_) {
+                ++below_;
+                return false;
+            }
+            if (e || v > hi_) {
+                ++above_;
+                return false;
+            }
+            return true;
+        }
+
+        static size_t width(u64t n) {
+            size_t d = 1;
+            while (d < 20 && n >= decPower(d)) ++d;
+            return d;
+        }
+        static char lead(u64t n) {
+            return static_cast<char>('0' + n / decPower(width(n) - 1));
+        }
+
+        u64t lo_, hi_;
+        char sep_;
+        size_t wlo_, whi_;   ///< digits in lo and hi
+        char llo_, lhi_;     ///< their leading digits
+        size_t fields_, kept_, above_, below_, malformed_, early_;
+    };
+
+    ///########################################################################
+    /// Fused lex and reduce: count, 128-bit sum, min, max and a histogram
+    /// of the values of a buffer of delimited fields (as lexFilterU64t,
+    /// which finds them), kept in registers as each is lexed, with no
+    /// column in between.  The histogram is log2 (slot 0 for 0, slot k
+    /// for [2^(k-1), 2^k), 65 slots) unless edges are given: then slot i
+    /// counts [edges[i-1], edges[i]), the first from 0 and the last to
+    /// the top, edges.size() + 1 slots (edges ascending).
+    ///
+    /// lexAggregateU64t reduce;                 // or reduce('\n', edges)
+    /// lexAggregateU64t::result all = reduce(base, size, threads);
+    /// total = all.total();  mean = all.mean();  all.histogram[k] ...
+    ///
+    /// A chunk (a buffer cut after a sep) reduces to a result on its own,
+    /// and results merge() in any order, so chunks can go to threads,
+    /// processes or machines; the threaded form cuts one per thread.
+    /// Malformed fields, and values outside [lo, hi] when the bounds are
+    /// given, are counted apart (bad, outside) and not reduced.
+    class lexAggregateU64t {
+     public:
+        struct result {
+            u64t count;      ///< values reduced
+            u64t sum[2];     ///< their sum: sum[0] low, sum[1] high word
+            u64t min, max;   ///< ~0 and 0 while count is 0
+            u64t bad;        ///< malformed fields
+            u64t outside;    ///< good fields outside [lo, hi]
+            std::vector<u64t> histogram;
+
+            explicit result(size_t slots = 65) : count(0), min(~0ULL),
+                max(0), bad(0), outside(0), histogram(slots, 0) {
+                sum[0] = sum[1] = 0;
+            }
+
+            result &merge(const result &o) {
+                count += o.count;
+                sum[0] += o.sum[0];
+                sum[1] += o.sum[1] + (sum[0] < o.sum[0]);
+                min = o.min < min ? o.min : min;
+                max = o.max > max ? o.max : max;
+                bad += o.bad;
+                outside += o.outside;
+                for (size_t i = 0; i < histogram.size(); ++i)
+                    histogram[i] += o.histogram[i];
+                return *this;
+            }
+
+#ifdef __SIZEOF_INT128__
+            u128t sum128() const { return u128t(sum[1]) << 64 | sum[0]; }
+#endif
+            double total() const { return sum[1] * 18446744073709551616.0 +
+                sum[0]; }
+            double mean() const { return count ? total() / count : 0; }
+        };
+
+        explicit lexAggregateU64t(
+                char sep = '\n',
+                const std::vector<u64t> &edges = std::vector<u64t>(),
+                u64t lo = 0,
+                u64t hi = ~0ULL)
+            : sep_(sep), edges_(edges), lo_(lo), hi_(hi) {}
+
+        /// Reduce the fields in size bytes at base: one chunk.
+        result operator()(const char *base, size_t size) const {
+            result out(slots());
+            u64t count = 0, low = 0, high = 0, min = ~0ULL, max = 0;
+            u64t *histogram = out.histogram.data();
+            lexFilterU64t fields(lo_, hi_, sep_);
+            if (edges_.empty()) {
+                fields.each(base, size, [&](u64t v, u64t) {
+                    ++count;
+                    low += v;
+                    high += low < v;
+                    min = v < min ? v : min;
+                    max = v > max ? v : max;
+                    ++histogram[v ? 64 - bitClz(v) : 0];
+                });
+            } else {
+                const u64t *first = edges_.data();
+                const u64t *last = first + edges_.size();
+                fields.each(base, size, [&](u64t v, u64t) {
+                    ++count;
+                    low += v;
+                    high += low < v;
+                    min = v < min ? v : min;
+                    max = v > max ? v : max;
+                    ++histogram[std::upper_bound(first, last, v) - first];
+                });
+            }
+            out.count = count;
+            out.sum[0] = low;
+            out.sum[1] = high;
+            out.min = min;
+            out.max = max;
+            out.bad = fields.malformed();
+            out.outside = fields.above() + fields.below();
+            return out;
+        }
+
+        /// Reduce size bytes at base as threads chunks, each cut after a
+        /// sep, on a thread each, and merge the results.
+        result operator()(const char *base, size_t size,
+                size_t threads) const {
+            if (!threads) threads = std::thread::hardware_concurrency();
+            if (!threads) threads = 1;
+            std::vector<size_t> cut(1, 0);
+            for (size_t t = 1; t < threads; ++t) {
+                size_t at = size / threads * t;
+                if (at <= cut.back()) continue;
+                const void *f = memchr(base + at, sep_, size - at);
+                at = f ? static_cast<const char *>(f) - base + 1 : size;
+                if (at < size) cut.push_back(at);
+            }
+            cut.push_back(size);
+            const size_t chunks = cut.size() - 1;
+            std::vector<result> part(chunks, result(slots()));
+            std::vector<std::thread> pool;
+            for (size_t c = 1; c < chunks; ++c) {
+                pool.emplace_back([&, c]() {
+                    part[c] = (*this)(base + cut[c], cut[c + 1] - cut[c]);
+                });
+            }
+            part[0] = (*this)(base, cut[1]);
+            for (size_t t = 0; t < pool.size(); ++t) pool[t].join();
+            for (size_t c = 1; c < chunks; ++c) part[0].merge(part[c]);
+            return part[0];
+        }
+
+        size_t slots() const { return edges_.empty() ? 65 :
+            edges_.size() + 1; }
+
+#ifdef LETTVIN_LEXERS_H_CPP_UNIT
+        /// Reduce random fields (some bad, some large enough that the sum
+        /// passes 2^64) as one chunk, as 1 to 4 threads and as 3 merged
+        /// chunks, with log2 and with given edges, and with bounds; and
+        /// compare each with a reduction of the values lexed one by one.
+        static void UnitTest() {
+            std::string text;
+            std::vector<u64t> value;
+            u64t x = 20160601ULL;   ///< LCG state
+            const char *junk[] = { "", "12a", "x", "18446744073709551616" };
+            size_t junked = 0, over = 0;   ///< 2^64 is above, not bad
+            for (size_t i = 0; i < 20000; ++i) {
+                x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+                char buffer[32];
+                if ((x >> 59) == 0) {
+                    text += junk[(x >> 33) % 4];
+                    junked += (x >> 33) % 4 != 3;
+                    over += (x >> 33) % 4 == 3;
+                } else {
+                    value.push_back(x >> (x >> 58));
+                    snprintf(buffer, sizeof(buffer), "%llu",
+                            static_cast<unsigned long long>(value.back()));
+                    text += buffer;
+                }
+                if (i + 1 < 20000) text += '\n';
+            }
+            std::vector<u64t> edges;
+            edges.push_back(10);
+            edges.push_back(1000000);
+            edges.push_back(1000000000000ULL);
+            const u64t lo = 1000, hi = 1000000000000000000ULL;
+            size_t mismatches = 0;
+            for (size_t k = 0; k < 3; ++k) {
+                const lexAggregateU64t reduce('\n', k == 1 ? edges :
+                        std::vector<u64t>(), k == 2 ? lo : 0,
+                        k == 2 ? hi : ~0ULL);
+                result want(reduce.slots());
+                for (size_t i = 0; i < value.size(); ++i) {
+                    const u64t v = value[i];
+                    if (v < reduce.lo_ || v > reduce.hi_) {
+                        ++want.outside;
+                        continue;
+                    }
+                    result one(reduce.slots());
+                    one.count = 1;
+                    one.sum[0] = one.min = one.max = v;
+                    size_t slot = 0;
+                    if (k == 1) {
+                        while (slot < edges.size() && v >= edges[slot])
+                            ++slot;
+                    } else {
+                        while (slot < 64 && v >> slot) ++slot;
+                    }
+                    ++one.histogram[slot];
+                    want.merge(one);
+                }
+                want.bad = junked;
+                want.outside += over;
+                std::vector<result> got;
+                got.push_back(reduce(text.data(), text.size()));
+                for (size_t t = 1; t <= 4; ++t)
+                    got.push_back(reduce(text.data(), text.size(), t));
+                const size_t a = text.find('\n', text.size() / 3) + 1;
+                const size_t b = text.find('\n', 2 * text.size() / 3) + 1;
+                result merged = reduce(text.data() + b, text.size() - b);
+                merged.merge(reduce(text.data(), a));
+                merged.merge(reduce(text.data() + a, b - a));
+                got.push_back(merged);
+                for (size_t g = 0; g < got.size(); ++g) {
+                    mismatches += got[g].count != want.count ||
+                        got[g].sum[0] != want.sum[0] ||
+                        got[g].sum[1] != want.sum[1] ||
+                        got[g].min != want.min || got[g].max != want.max ||
+                        got[g].bad != want.bad ||
+                        got[g].outside != want.outside ||
+                        got[g].histogram != want.histogram;
+                }
+                if (k == 0) {
+                    std::cout << "aggregate: " << want.count <<
+                        " values sum " << want.sum[1] << ":" <<
+                        want.sum[0] << " min " << want.min << std::endl;
+                }
+            }
+            std::cout << "aggregate: " << mismatches << " mismatches" <<
+                std::endl;
+        }
+#endif
+
+     private:
+        char sep_;
+        std::vector<u64t> edges_;
+        u64t lo_, hi_;
+    };
+
+    ///########################################################################
+    /// Zero-copy decoder for FIX messages: fields "tag=value" each ended
+    /// by Soh, with integer tags.  One object serves a whole session: its
+    /// field list and tag-to-field index are fixed arrays, so decoding a
+    /// message allocates nothing and a lookup is one index read:
+    ///
+    /// lexTagValue<> fix;
+    /// if (fix(message, size, error) && fix.has(35)) ...
+    /// fix.number(quantity, 38, error);
+    /// const char *symbol = fix.value(55, length);
+    ///
+    /// The message is read once, 64 bytes at a time, as in lexRecords:
+    /// vector compares give a mask of the '=' and Soh bytes and a mask of
+    /// the bytes that are neither those nor digits, and _mm_sad_epu8 adds
+    /// every byte up for the checksum.  The first '=' of a field ends its
+    /// tag, summed from the lexDecU64t columns with its length known
+    /// (lexDecU64t itself past 9 digits); the Soh ends its value, which
+    /// is kept as an offset and size (a value holding no non-digit is
+    /// marked for number()).  Tags of T and above are kept in the list
+    /// but found by a scan; a repeated tag (a repeating group) indexes
+    /// its first field.
+    /// Tag 10, when present, must be 3 digits equal to the sum of the
+    /// bytes before its field modulo 256; that sum is the message total
+    /// less the bytes from "10=" on, so there is no second pass.
+    /// A field with no '=', an empty, non-digit or 0 tag, a message not
+    /// ended by Soh, more than F fields or a wrong checksum sets e |= 1,
+    /// leaves no fields and records the byte offset for where().
+    template <char Soh = '\001', size_t T = 1024, size_t F = 256>
+    class lexTagValue {
+     public:
+        static_assert(F < 65536, "fields are indexed by u16t");
+
+        struct field {
+            u32t tag;       ///< tag number
+            u32t at;        ///< offset of the value in the message
+            u32t size;      ///< bytes in the value
+            u32t digits;    ///< 1 when the value is 1 or more digits only
+        };
+
+        lexTagValue() : base_(0), count_(0), where_(0), sum_(0) {
+            memset(index_, 0, sizeof(index_));
+        }
+
+        /// Decode size bytes at base; return the field count, 0 on error.
+        size_t operator()(const char *base, size_t size,
+                u64t &e) {                                          // NOLINT
+            clear();
+            base_ = base;
+            if (e) return 0;
+            size_t start = 0;       ///< offset of the open field
+            size_t equal = 0;       ///< past its first '=', 0 before it
+            size_t others = 0;      ///< non-digits since the last delimiter
+            size_t check = size;    ///< offset of the tag 10 field
+            u64t total = 0;         ///< sum of the bytes
+            for (size_t at = 0; at < size; at += 64) {
+                u64t delim, other;
+                masks(base + at, size - at < 64 ? size - at : 64,
+                        delim, other, total);
+                u64t done = 0;      ///< bits of segments already ended
+                for (; delim; delim &= delim - 1) {
+                    const size_t bit = bitCtz(delim);
+                    const u64t below = (1ULL << bit) - 1;
+                    const size_t p = at + bit;
+                    others += bits(other & below & ~done);
+                    done = below | (1ULL << bit);
+                    if (base[p] == '=' && equal) {
+                        ++others;   ///< a later '=' belongs to the value
+                    } else if (base[p] == '=') {
+                        u64t t = 0, bad = count_ == F || others;
+                        tag(t, base + start, bad, p - start);
+                        if (bad || p == start) return fail(start, e);
+                        if (t == 10 && check == size) check = start;
+                        fields_[count_].tag = static_cast<u32t>(t);
+                        equal = p + 1;
+                        others = 0;
+                    } else if (!equal) {
+                        return fail(start, e);
+                    } else {
+                        add(equal, p, others);
+                        start = p + 1;
+                        equal = others = 0;
+                    }
+                }
+                others += bits(other & ~done);
+            }
+            if (start != size) return fail(start, e);
+            for (size_t i = check; i < size; ++i) {
+                total -= static_cast<u08t>(base[i]);
+            }
+            sum_ = static_cast<u32t>(total & 255);
+            const field *c = find(10);
+            if (c && (c->size != 3 || !c->digits ||
+                        col(base + c->at) != sum_)) {
+                return fail(c->at, e);
+            }
+            return count_;
+        }
+
+        size_t count() const { return count_; }
+        const field &operator[](size_t i) const { return fields_[i]; }
+
+        /// The first field with tag t, or 0.
+        const field *find(u32t t) const {
+            if (t < T) return index_[t] ? fields_ + index_[t] - 1 : 0;
+            for (size_t i = 0; i < count_; ++i) {
+                if (fields_[i].tag == t) return fields_ + i;
+            }
+            return 0;
+        }
+
+        bool has(u32t t) const { return find(t) != 0; }
+
+        /// The value of tag t in the message and its size, or 0 and 0.
+        const char *value(u32t t, size_t &size) const {  // NOLINT
+            const field *f = find(t);
+            size = f ? f->size : 0;
+            return f ? base_ + f->at : 0;
+        }
+
+        /// Lex the value of tag t with lexDecU64t: a missing tag, or a
+        /// value that is empty or holds a non-digit, is an error.
+        u64t &number(u64r v, u32t t, u64t &e,                  // NOLINT
+                u64t hi = ~0ULL, u64t lo = 0) const {
+            const field *f = find(t);
+            if (e || (e |= !f || !f->digits)) return v = 0;
+            char *s = const_cast<char *>(base_ + f->at);
+            return lexDecU64_Instance(v, s, e, f->size, hi, lo);
+        }
+
+        /// Byte offset of the last error.
+        u64t where() const { return where_; }
+
+        /// The byte sum modulo 256 before tag 10 (or of the message).
+        u32t checksum() const { return sum_; }
+
+#ifdef LETTVIN_LEXERS_H_CPP_UNIT
+        /// Decode random messages, with repeating groups, tags past T and
+        /// damaged fields, checksums and endings mixed in, and compare
+        /// every field, lookup and error offset with a byte loop.
+        static void UnitTest() {
+            lexTagValue<Soh, T, 48> fix;
+            size_t messages = 0, errors = 0, mismatches = 0;
+            u64t x = 20180713ULL;   ///< LCG state
+            for (size_t k = 0; k < 2000; ++k, ++messages) {
+                std::string m = "8=FIX.4.4";
+                m += Soh;
+                size_t n = 0;       ///< fields added
+                x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+                const size_t groups = (x >> 60) % 4;
+                const size_t extra = (x >> 30) % 64 == 0 ? 60 : 0;
+                for (size_t i = 0; i < 8 + 2 * groups + extra; ++i, ++n) {
+                    x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+                    static const u32t tags[] = {
+                        35, 49, 56, 34, 11, 55, 54, 38, 44, 60, 9001 };
+                    const u32t t = i < 8 ? tags[(x >> 40) % 11] :
+                        i < 8 + 2 * groups ? 447 + (i & 1) : 58;
+                    char field[64];
+                    if ((x >> 36) % 3) {
+                        snprintf(field, sizeof(field), "%u=%llu", t,
+                                static_cast<unsigned long long>(
+                                    x >> (x >> 58)));
+                    } else {
+                        snprintf(field, sizeof(field), "%u=A%u.%u=B", t,
+                                u32t(x >> 50), u32t(x >> 20) % 100);
+                    }
+                    m += field;
+                    m += Soh;
+                }
+                /// 1-4 a bad second field, 5 no checksum, 6 a wrong one,
+                /// 7 no final Soh.
+                const size_t damage = (x >> 8) % 16;
+                const std::string bad[] = { "", "12x=3", "=3", "123", "0=3" };
+                if (damage && damage < 5) {
+                    m.insert(m.find(Soh) + 1, bad[damage] + Soh);
+                }
+                if (damage != 5) {
+                    u32t sum = 0;
+                    for (size_t i = 0; i < m.size(); ++i) {
+                        sum += static_cast<u08t>(m[i]);
+                    }
+                    char field[16];
+                    snprintf(field, sizeof(field), "10=%03u",
+                            (sum + (damage == 6)) % 256);
+                    m += field;
+                    m += Soh;
+                }
+                if (damage == 7) m.resize(m.size() - 1);
+                u64t e = 0;
+                const size_t got = fix(m.data(), m.size(), e);
+                mismatches += compare(fix, m, got, e);
+                errors += e != 0;
+            }
+            std::cout << "tagvalue: " << messages << " messages " << errors <<
+                " errors " << mismatches << " mismatches" << std::endl;
+        }
+
+        /// Decode m a field at a time with find() and count where fix,
+        /// which returned got and e, differs.
+        template <typename D>
+        static size_t compare(const D &fix, const std::string &m,
+                size_t got, u64t e) {
+            const size_t none = std::string::npos;
+            std::vector<field> want;
+            size_t start = 0, check = m.size(), wrong = none;
+            while (start < m.size() && wrong == none) {
+                const size_t soh = m.find(Soh, start);
+                const size_t eq = m.find('=', start);
+                const std::string tag = m.substr(start, eq - start);
+                const u64t t = strtoull(tag.c_str(), 0, 10);
+                if (eq == none || eq > soh || tag.empty() ||
+                        tag.find_first_not_of("0123456789") != none ||
+                        tag.size() > 10 || t == 0 || t > 0xFFFFFFFFULL ||
+                        want.size() == 48 || soh == none) {
+                    wrong = start;
+                    break;
+                }
+                field f;
+                f.tag = static_cast<u32t>(t);
+                f.at = static_cast<u32t>(eq + 1);
+                f.size = static_cast<u32t>(soh - eq - 1);
+                f.digits = f.size && m.substr(eq + 1, f.size).
+                    find_first_not_of("0123456789") == none;
+                want.push_back(f);
+                if (t == 10 && check == m.size()) check = start;
+                start = soh + 1;
+            }
+            u32t sum = 0;
+            for (size_t i = 0; i < check && i < m.size(); ++i) {
+                sum += static_cast<u08t>(m[i]);
+            }
+            sum %= 256;
+            for (size_t i = 0; i < want.size() && wrong == none; ++i) {
+                if (want[i].tag != 10) continue;
+                if (!want[i].digits || want[i].size != 3 ||
+                        strtoul(m.c_str() + want[i].at, 0, 10) != sum) {
+                    wrong = want[i].at;
+                }
+                break;
+            }
+            if (wrong != none) {
+                return (got != 0) + (e != 1) + (fix.where() != wrong) +
+                    (fix.count() != 0);
+            }
+            size_t mismatches = (got != want.size()) + (e != 0) +
+                (fix.checksum() != sum) + fix.has(12345);
+            for (size_t i = 0; i < want.size() && i < got; ++i) {
+                const typename D::field &f = fix[i];
+                mismatches += f.tag != want[i].tag || f.at != want[i].at ||
+                    f.size != want[i].size || f.digits != want[i].digits;
+                size_t j = 0;
+                while (want[j].tag != want[i].tag) ++j;
+                mismatches += fix.find(want[i].tag) != &fix[j];
+                u64t v = 7, err = 0;
+                fix.number(v, want[i].tag, err);
+                const u64t n = strtoull(m.c_str() + want[j].at, 0, 10);
+                mismatches += want[j].digits && want[j].size <= 19 ?
+                    err || v != n : !want[j].digits && (!err || v);
+            }
+            return mismatches;
+        }
+#endif
+
+     private:
+        /// Drop the last message's fields from the index.
+        void clear() {
+            for (size_t i = 0; i < count_; ++i) {
+                if (fields_[i].tag < T) index_[fields_[i].tag] = 0;
+            }
+            count_ = 0;
+        }
+
+        /// End the field whose value is [from, to).
+        inline void add(size_t from, size_t to, size_t others) {
+            field &f = fields_[count_];
+            f.at = static_cast<u32t>(from);
+            f.size = static_cast<u32t>(to - from);
+            f.digits = to > from && !others;
+            ++count_;
+            if (f.tag < T && !index_[f.tag]) {
+                index_[f.tag] = static_cast<u16t>(count_);
+            }
+        }
+
+        /// Tags of up to 9 digits, checked by the masks, are summed from
+        /// the lexDecU64t columns directly; longer ones go to lexDecU64t.
+        static inline void tag(u64t &t, const char *s, u64t &e,  // NOLINT
+                size_t d) {
+            if (e || d > 9) {
+                char *p = const_cast<char *>(s);
+                lexDecU64_Instance(t, p, e, d, 0xFFFFFFFF, 1);
+                return;
+            }
+            for (const u08t *c = reinterpret_cast<const u08t *>(s); d; ++c) {
+                t += decTable<u64t>::col[--d][*c];
+            }
+            e |= !t;
+        }
+
+        inline size_t fail(size_t at, u64t &e) {  // NOLINT
+            e |= 1;
+            where_ = at;
+            clear();
+            return 0;
+        }
+
+        /// Three digits at p through the lexDecU64t columns.
+        static inline u32t col(const char *p) {
+            return u32t(decTable<u64t>::col[2][static_cast<u08t>(p[0])] +
+                    decTable<u64t>::col[1][static_cast<u08t>(p[1])] +
+                    decTable<u64t>::col[0][static_cast<u08t>(p[2])]);
+        }
+
+        static inline size_t bits(u64t m) {
+            return m ? bitCount(m) : 0;
+        }
+
+        /// Set delim for the '=' and Soh bytes among the n bytes at p,
+        /// other for the bytes that are neither those nor digits, and add
+        /// the n bytes to total.
+        static inline void masks(const char *p, size_t n,
+                u64t &delim, u64t &other, u64t &total) {  // NOLINT
+            char pad[64];
+            if (n < 64) {
+                memset(pad, 0, sizeof(pad));
+                memcpy(pad, p, n);
+                p = pad;
+            }
+#if LETTVIN_LEXDEC_SIMD
+            const __m128i soh = _mm_set1_epi8(Soh);
+            const __m128i eq = _mm_set1_epi8('=');
+            const __m128i zero = _mm_set1_epi8('0');
+            const __m128i nine = _mm_set1_epi8(9);
+            __m128i sum = _mm_setzero_si128();
+            delim = other = 0;
+            for (int i = 0; i < 64; i += 16) {
+                const __m128i x = _mm_loadu_si128(
+                        reinterpret_cast<const __m128i *>(p + i));
+                const u64t d = static_cast<u32t>(_mm_movemask_epi8(
+                        _mm_or_si128(_mm_cmpeq_epi8(x, soh),
+                            _mm_cmpeq_epi8(x, eq))));
+                const __m128i y = _mm_sub_epi8(x, zero);
+                const u64t g = static_cast<u32t>(_mm_movemask_epi8(
+                        _mm_cmpeq_epi8(_mm_max_epu8(y, nine), nine)));
+                delim |= d << i;
+                other |= (~(d | g) & 0xFFFF) << i;
+                sum = _mm_add_epi64(sum,
+                        _mm_sad_epu8(x, _mm_setzero_si128()));
+            }
+            total += static_cast<u64t>(_mm_cvtsi128_si64(sum)) +
+                static_cast<u64t>(_mm_cvtsi128_si64(
+                            _mm_unpackhi_epi64(sum, sum)));
+#else
+            delim = other = 0;
+            for (size_t i = 0; i < 64; ++i) {
+                const bool d = p[i] == Soh || p[i] == '=';
+                delim |= u64t(d) << i;
+                other |= u64t(!d && static_cast<u08t>(p[i] - '0') > 9) << i;
+                total += static_cast<u08t>(p[i]);
+            }
+#endif
+            if (n < 64) other &= (1ULL << n) - 1;
+        }
+
+        const char *base_;
+        size_t count_;
+        u64t where_;
+        u32t sum_;
+        field fields_[F];
+        u16t index_[T];     ///< 1 + field of each tag below T, 0 if none
+    };
 }  // namespace Lettvin
 
 #ifdef LETTVIN_LEXERS_H_CPP_UNIT
@@ -662,6 +6581,42 @@ int main(int argc, char *argv[]) {
   try {
     CONFIRM_DATA_SIZES;
     Lettvin::lexDecU64_Instance.UnitTest();
+    Lettvin::lexDecU64_Instance.UnitTestCompact();
+    Lettvin::lexDecU64_Instance.UnitTestKernel();
+    Lettvin::lexDecU64_Instance.UnitTestThreads();
+    Lettvin::lexDecU64_Instance.UnitTestDelimited();
+    Lettvin::lexDecU64_Instance.UnitTestColumn();
+    Lettvin::lexDecU64_Instance.UnitTestFormat();
+    Lettvin::lexDecU64_Instance.UnitTestStats();
+    Lettvin::lexDecU64_Instance.UnitTestWidths();
+    Lettvin::lexDecU08_Instance.UnitTest("u08t");
+    Lettvin::lexDecS08_Instance.UnitTest("s08t");
+    Lettvin::lexDecU16_Instance.UnitTest("u16t");
+    Lettvin::lexDecS16_Instance.UnitTest("s16t");
+    Lettvin::lexDecU32_Instance.UnitTest("u32t");
+    Lettvin::lexDecS32_Instance.UnitTest("s32t");
+    Lettvin::lexDec<Lettvin::u64t>().UnitTest("u64t");
+    Lettvin::lexDecS64_Instance.UnitTest("s64t");
+#ifdef __SIZEOF_INT128__
+    Lettvin::lexDecU128_Instance.UnitTest();
+#endif
+    Lettvin::lexDecF32_Instance.UnitTest("f32t");
+    Lettvin::lexDecF64_Instance.UnitTest("f64t");
+    Lettvin::lexFixS64_Instance.UnitTest();
+    Lettvin::lexTimeU64_Instance.UnitTest();
+    Lettvin::lexHexU64_Instance.UnitTest("lexHexU64t");
+    Lettvin::lexB36U64_Instance.UnitTest("lexB36U64t");
+    Lettvin::lexLinesU64_Instance.UnitTest();
+#if defined(__unix__) || defined(__APPLE__)
+    Lettvin::lexCacheU64t::UnitTest();
+#endif
+    Lettvin::lexStreamU64t::UnitTest();
+    Lettvin::lexRecords<','>::UnitTest();
+    Lettvin::lexRecords<'\t'>::UnitTest();
+    Lettvin::lexRangeU64t::UnitTest();
+    Lettvin::lexFilterU64t::UnitTest();
+    Lettvin::lexAggregateU64t::UnitTest();
+    Lettvin::lexTagValue<>::UnitTest();
     retval = 0;
   }
 #if 0
@@ -0,0 +1,53 @@
+// Copyright 2016 Jonathan D. Lettvin All Rights Reserved
+/// atoull.nognu.cpp
+/// The unit test as a compiler without the GNU extensions sees the
+/// header (MSVC, strict ISO), with g++.  Built and run by "make nognu".
+///
+/// The standard headers are included first, as they use the builtins
+/// themselves.  Then __GNUC__ and the byte-order macros are removed,
+/// which selects the portable engine and turns off the vector kernels,
+/// and the GCC builtins are poisoned: any use in atoull.h.cpp not under
+/// a guard fails to compile, and a guard that takes the wrong branch
+/// changes the output compared with atoull.pass.txt.  unsigned __int128
+/// has its own test, __SIZEOF_INT128__, and is left to it.
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#undef __GNUC__
+#undef __BYTE_ORDER__
+#undef __ORDER_BIG_ENDIAN__
+#undef __ORDER_LITTLE_ENDIAN__
+#pragma GCC poison __builtin_clzll __builtin_ctzll __builtin_popcountll
+#pragma GCC poison __builtin_clz __builtin_ctz __builtin_bswap64
+#pragma GCC poison __builtin_cpu_init __builtin_cpu_supports
+#pragma GCC poison __attribute__
+
+#include "atoull.h.cpp"
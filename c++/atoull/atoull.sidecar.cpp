@@ -0,0 +1,36 @@
+// Copyright 2016 Jonathan D. Lettvin All Rights Reserved
+/// atoull.sidecar.cpp
+/// Build or refresh the lexCacheU64t sidecar of each file named, so that
+/// later runs map the column instead of lexing the text.
+/// Built by "make sidecar".
+///
+/// ./atoull.sidecar file...
+///   prints, per file: path, lines, bad lines, and "mapped" when the
+///   sidecar was current or "lexed" when it was (re)built.
+/// Exits 1 if any file could not be read.
+
+#include <iostream>
+
+#include "atoull.h.cpp"
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " file..." << std::endl;
+        return 2;
+    }
+    int status = 0;
+    for (int i = 1; i < argc; ++i) {
+        Lettvin::lexCacheU64t cache;
+        Lettvin::u64t e = 0;
+        cache.open(argv[i], e);
+        if (e) {
+            std::cerr << argv[i] << ": cannot read" << std::endl;
+            status = 1;
+            continue;
+        }
+        std::cout << argv[i] << ": " << cache.size() << " lines " <<
+            cache.failed() << " errors " <<
+            (cache.cached() ? "mapped" : "lexed") << std::endl;
+    }
+    return status;
+}
@@ -0,0 +1,97 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+"""
+bench_lexdec
+----------------------------------
+
+Time lexdec.lines() against the int()-per-token loop it replaces.
+
+The numbers are those parlogser reports for testdata: the row, column
+and byte offset of every word it anchors on, one per line, repeated
+until there are at least --count of them, with one bad line in 1000.
+Build the extension first (python setup.py build_ext -i), then run
+from this directory:
+
+    python bench_lexdec.py [--count N] [--repeat R]
+"""
+
+from __future__ import print_function
+
+import argparse
+import os
+import re
+import timeit
+
+try:
+    import lexdec
+except ImportError:
+    from parlogser import lexdec
+
+
+def numbers(path):
+    "row, col and offset of each word in path, as parlogser finds them"
+    with open(path, 'rb') as source:
+        text = source.read()
+    found = []
+    for match in re.finditer(br'[A-Za-z]+', text):
+        start = match.start()
+        row = text.count(b'\n', 0, start) + 1
+        col = start - (text.rfind(b'\n', 0, start) + 1) + 1
+        found.extend((row, col, start))
+    return found
+
+
+def corpus(path, count):
+    "at least count lines of numbers, one bad line in 1000"
+    base = numbers(path)
+    lines = []
+    while len(lines) < count:
+        lines.extend(str(n).encode('ascii') for n in base)
+    for i in range(0, len(lines), 1000):
+        lines[i] = b'x' + lines[i]
+    return b'\n'.join(lines) + b'\n'
+
+
+def python(data):
+    "int() per line; bad lines are 0 with their offsets in errors"
+    values, errors, offset = [], [], 0
+    for line in data.split(b'\n')[:-1]:
+        try:
+            values.append(int(line))
+        except ValueError:
+            values.append(0)
+            errors.append(offset)
+        offset += len(line) + 1
+    return values, errors
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[4])
+    parser.add_argument('--count', type=int, default=1000000)
+    parser.add_argument('--repeat', type=int, default=5)
+    parser.add_argument('--data', default=os.path.join(
+        os.path.dirname(os.path.abspath(__file__)), 'testdata'))
+    args = parser.parse_args()
+
+    data = corpus(args.data, args.count)
+    want = python(data)
+    got = lexdec.lines(data)
+    same = (list(got[0]) == want[0] and list(got[1]) == want[1])
+    print('%d numbers, %d bytes, %d errors, results %s' % (
+        len(want[0]), len(data), len(want[1]),
+        'match' if same else 'MISMATCH'))
+
+    for name, call in (
+            ('int() per line', lambda: python(data)),
+            ('lexdec.lines', lambda: lexdec.lines(data)),
+            ('lexdec.lines 1 thread', lambda: lexdec.lines(data, 1)),
+            ('lexdec.lines to list', lambda: list(lexdec.lines(data)[0]))):
+        best = min(timeit.repeat(call, number=1, repeat=args.repeat))
+        print('%-24s %8.2f ms %8.2f ns/number' % (
+            name, best * 1e3, best * 1e9 / len(want[0])))
+    return 0 if same else 1
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
@@ -0,0 +1,171 @@
+// Copyright 2016 Jonathan D. Lettvin All Rights Reserved
+/// lexdec.cpp
+/// CPython extension: batch decimal lexing with c++/atoull/atoull.h.cpp,
+/// so a tool reading numeric fields builds one array per buffer rather
+/// than one int() per token.  Built by "python setup.py build_ext -i".
+///
+/// from parlogser import lexdec
+/// values, errors = lexdec.lines(data)          # one number per line
+/// values, errors = lexdec.fields(data, b',')   # fields ending in sep
+///
+/// data is any object with the buffer protocol (str in 2.7, bytes,
+/// bytearray, mmap, memoryview).  values and errors are array('Q')
+/// (array('L') under 2.7, where 'Q' is missing; it is 64 bits on LP64).
+/// errors holds the byte offsets of the bad fields: lines() keeps a 0 in
+/// values for each, so values[i] is line i; fields() leaves them out.
+/// A good field is 1 to 20 digits within 18446744073709551615.
+/// The GIL is released while lexing; lines() uses every core.  Running
+/// out of memory raises MemoryError, other C++ failures RuntimeError.
+
+#include <Python.h>
+
+#include <cstdio>
+#include <exception>
+#include <new>
+#include <vector>
+
+#include "atoull.h.cpp"
+
+namespace {
+
+typedef Lettvin::u64t u64t;
+
+#if PY_MAJOR_VERSION >= 3
+const char *const kCode = "Q";
+const char *const kBuffer = "y*|n:lines";
+const char *const kBufferSep = "y*|c:fields";
+#else
+const char *const kCode = "L";
+const char *const kBuffer = "s*|n:lines";
+const char *const kBufferSep = "s*|c:fields";
+#endif
+
+PyObject *arrayType = 0;   ///< array.array, found at import
+
+/// A new array of kCode holding column, through its bytes initializer,
+/// so no Python object is made per value.
+PyObject *toArray(const std::vector<u64t> &column) {
+    PyObject *bytes = PyBytes_FromStringAndSize(
+            reinterpret_cast<const char *>(column.data()),
+            column.size() * sizeof(u64t));
+    if (!bytes) return 0;
+    PyObject *array = PyObject_CallFunction(arrayType, const_cast<char *>(
+                "sO"), kCode, bytes);
+    Py_DECREF(bytes);
+    return array;
+}
+
+PyObject *toPair(const std::vector<u64t> &values,
+        const std::vector<u64t> &errors) {
+    PyObject *v = toArray(values);
+    PyObject *e = v ? toArray(errors) : 0;
+    PyObject *pair = e ? PyTuple_Pack(2, v, e) : 0;
+    Py_XDECREF(v);
+    Py_XDECREF(e);
+    return pair;
+}
+
+/// Run lex with the GIL released.  A C++ exception must not unwind
+/// through the interpreter, so it is caught here and, with the GIL held
+/// again, raised as MemoryError (std::bad_alloc) or RuntimeError (the
+/// rest, e.g. std::system_error when no thread can be started).
+/// Returns false with the Python error set.
+template <typename F>
+bool released(F lex) {
+    enum { none, memory, runtime } failed = none;
+    char what[160] = "";
+    Py_BEGIN_ALLOW_THREADS
+    try {
+        lex();
+    } catch (const std::bad_alloc &) {
+        failed = memory;
+    } catch (const std::exception &error) {
+        failed = runtime;
+        snprintf(what, sizeof(what), "lexdec: %s", error.what());
+    } catch (...) {
+        failed = runtime;
+        snprintf(what, sizeof(what), "lexdec: unknown C++ exception");
+    }
+    Py_END_ALLOW_THREADS
+    if (failed == memory) PyErr_NoMemory();
+    if (failed == runtime) PyErr_SetString(PyExc_RuntimeError, what);
+    return failed == none;
+}
+
+PyObject *lines(PyObject *, PyObject *args) {
+    Py_buffer data;
+    Py_ssize_t threads = 0;
+    if (!PyArg_ParseTuple(args, kBuffer, &data, &threads)) return 0;
+    std::vector<u64t> values, errors;
+    const bool lexed = released([&]() {
+        Lettvin::lexLinesU64_Instance(static_cast<const char *>(data.buf),
+                size_t(data.len), values, errors,
+                threads > 0 ? size_t(threads) : 0);
+    });
+    PyBuffer_Release(&data);
+    return lexed ? toPair(values, errors) : 0;
+}
+
+PyObject *fields(PyObject *, PyObject *args) {
+    Py_buffer data;
+    char sep = ',';
+    if (!PyArg_ParseTuple(args, kBufferSep, &data, &sep)) return 0;
+    std::vector<u64t> values, errors;
+    const bool lexed = released([&]() {
+        Lettvin::lexRangeU64t range(static_cast<const char *>(data.buf),
+                size_t(data.len), sep, &errors);
+        for (Lettvin::lexRangeU64t::iterator i = range.begin();
+                i != range.end(); ++i) values.push_back(*i);
+    });
+    PyBuffer_Release(&data);
+    return lexed ? toPair(values, errors) : 0;
+}
+
+PyMethodDef methods[] = {
+    {"lines", lines, METH_VARARGS,
+        "lines(data, threads=0) -> (values, errors): one number per line"},
+    {"fields", fields, METH_VARARGS,
+        "fields(data, sep=b',') -> (values, errors): fields ending in sep"},
+    {0, 0, 0, 0}
+};
+
+/// Find array.array and check that kCode holds a u64t.
+bool init() {
+    PyObject *module = PyImport_ImportModule("array");
+    if (!module) return false;
+    arrayType = PyObject_GetAttrString(module, "array");
+    Py_DECREF(module);
+    if (!arrayType) return false;
+    PyObject *probe = PyObject_CallFunction(arrayType, const_cast<char *>(
+                "s"), kCode);
+    PyObject *size = probe ? PyObject_GetAttrString(probe, "itemsize") : 0;
+    const long itemsize = size ? PyLong_AsLong(size) : 0;
+    Py_XDECREF(probe);
+    Py_XDECREF(size);
+    if (PyErr_Occurred()) return false;
+    if (itemsize != sizeof(u64t)) {
+        PyErr_SetString(PyExc_ImportError,
+                "lexdec: no 64-bit unsigned array typecode");
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+#if PY_MAJOR_VERSION >= 3
+static struct PyModuleDef lexdecModule = {
+    PyModuleDef_HEAD_INIT, "lexdec", "Batch decimal lexing (atoull).",
+    -1, methods, 0, 0, 0, 0
+};
+
+PyMODINIT_FUNC PyInit_lexdec(void) {
+    if (!init()) return 0;
+    return PyModule_Create(&lexdecModule);
+}
+#else
+PyMODINIT_FUNC initlexdec(void) {
+    if (!init()) return;
+    Py_InitModule3("lexdec", methods, "Batch decimal lexing (atoull).");
+}
+#endif
@@ -2,10 +2,16 @@
 # -*- coding: utf-8 -*-
 
 
+import os
+import shutil
+
 try:
-    from setuptools import setup
+    from setuptools import setup, Extension
+    from setuptools.command.build_ext import build_ext
 except ImportError:
-    from distutils.core import setup
+    from distutils.core import setup, Extension
+    from distutils.command.build_ext import build_ext
+from distutils.errors import CCompilerError, DistutilsError
 
 
 with open('README.rst') as readme_file:
@@ -22,6 +28,58 @@ test_requirements = [
     # TODO: put package test requirements here
 ]
 
+# Batch decimal lexing over c++/atoull (python setup.py build_ext -i).
+# lexdec.cpp includes atoull.h.cpp from its own directory: in a checkout
+# the header is copied there from c++/atoull, and MANIFEST.in ships that
+# copy in the sdist, which has no c++/atoull.  The extension is optional:
+# if it fails to build, parlogser installs without it and its tests skip.
+header = os.path.join('..', '..', 'c++', 'atoull', 'atoull.h.cpp')
+vendored = os.path.join('parlogser', 'atoull.h.cpp')
+if os.path.exists(header) and (
+        not os.path.exists(vendored) or
+        os.path.getmtime(header) > os.path.getmtime(vendored)):
+    shutil.copyfile(header, vendored)
+
+lexdec = Extension(
+    'parlogser.lexdec',
+    sources=['parlogser/lexdec.cpp'],
+    depends=[vendored],
+)
+lexdec.optional = True   # as optional=True, which 2.7 distutils rejects
+
+
+class build_lexdec(build_ext):
+    "C++11 and threads, in the spelling of the compiler found"
+
+    def build_extensions(self):
+        if self.compiler.compiler_type == 'msvc':
+            compile_args, link_args = ['/O2', '/EHsc'], []
+        else:
+            compile_args = ['-std=c++11', '-O2', '-pthread',
+                            '-Wno-unused-variable']
+            link_args = ['-pthread']
+        for extension in self.extensions:
+            extension.extra_compile_args = compile_args
+            extension.extra_link_args = link_args
+        build_ext.build_extensions(self)
+
+    def build_extension(self, extension):
+        "skip an optional extension that fails, as 2.7 distutils does not"
+        try:
+            build_ext.build_extension(self, extension)
+        except (CCompilerError, DistutilsError, OSError) as error:
+            if not getattr(extension, 'optional', False):
+                raise
+            self.warn('%s not built (%s); parlogser works without it' % (
+                extension.name, error))
+            self.skipped = getattr(self, 'skipped', []) + [extension]
+
+    def copy_extensions_to_source(self):
+        "build_ext -i: copy what was built, not what was skipped"
+        skipped = getattr(self, 'skipped', [])
+        self.extensions = [e for e in self.extensions if e not in skipped]
+        build_ext.copy_extensions_to_source(self)
+
 setup(
     name='parlogser',
     version='0.1.0',
@@ -35,6 +93,8 @@ setup(
     ],
     package_dir={'parlogser':
                  'parlogser'},
+    ext_modules=[lexdec],
+    cmdclass={'build_ext': build_lexdec},
     include_package_data=True,
     install_requires=requirements,
     license="ISCL",
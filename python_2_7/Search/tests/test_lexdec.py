@@ -0,0 +1,69 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+"""
+test_lexdec
+----------------------------------
+
+Tests for the `lexdec` extension (python setup.py build_ext -i).
+"""
+
+import os
+import subprocess
+import sys
+
+import pytest
+
+lexdec = pytest.importorskip('parlogser.lexdec')
+
+
+class TestLexdec(object):
+
+    def test_lines(self):
+        data = b'1\n22\nx\n18446744073709551615\n18446744073709551616\n7'
+        values, errors = lexdec.lines(data)
+        assert list(values) == [1, 22, 0, 18446744073709551615, 0, 7]
+        assert list(errors) == [5, 28]
+        assert values.itemsize == 8
+
+    def test_lines_buffers(self):
+        data = b''.join(b'%d\r\n' % n for n in range(1000))
+        for view in (data, bytearray(data), memoryview(data)):
+            values, errors = lexdec.lines(view, 3)
+            assert list(values) == list(range(1000))
+            assert len(errors) == 0
+
+    def test_fields(self):
+        values, errors = lexdec.fields(b'5,6,a,,7,', b',')
+        assert list(values) == [5, 6, 7]
+        assert list(errors) == [4, 6]
+
+    def test_empty(self):
+        values, errors = lexdec.lines(b'')
+        assert len(values) == 0 and len(errors) == 0
+
+    def test_not_a_buffer(self):
+        with pytest.raises(TypeError):
+            lexdec.lines(12)
+
+    @pytest.mark.skipif(not sys.platform.startswith('linux'),
+                        reason='needs RLIMIT_AS and /proc')
+    def test_out_of_memory(self):
+        "bad_alloc while the GIL is released is MemoryError, not abort"
+        child = '\n'.join([
+            'import resource, sys',
+            'sys.path.insert(0, %r)' % os.path.dirname(
+                os.path.dirname(os.path.abspath(lexdec.__file__))),
+            'from parlogser import lexdec',
+            'data = b"1\\n" * (32 << 20)',
+            'page = resource.getpagesize()',
+            'used = int(open("/proc/self/statm").read().split()[0]) * page',
+            'hard = resource.getrlimit(resource.RLIMIT_AS)[1]',
+            'resource.setrlimit(resource.RLIMIT_AS, (used + (128 << 20), '
+            'hard))',
+            'try:',
+            '    lexdec.lines(data, 1)',
+            'except MemoryError:',
+            '    sys.exit(3)',
+        ])
+        assert subprocess.call([sys.executable, '-c', child]) == 3